@@ -1,12 +1,20 @@
-rm YAN
+rm YAN libyan.a libyan.so
 rm src/RuleTable.c
 set -e
 Str=`ls src/*.c | xargs`
 echo $Str
 echo "Compilation started: Unused code will be printed and removed from the binary:"
-BaseFlags="-fopenmp -D_POSIX_C_SOURCE=199506L -pedantic -std=c99 -g3 -O3 $Str -lm -oYAN"
+BaseFlags="-fopenmp -pthread -D_POSIX_C_SOURCE=199506L -pedantic -std=c99 -g3 -O3 $Str -lm -oYAN"
 gcc -DSTAGE=1 -Wall -Wextra -Wformat-security $BaseFlags
 echo "First stage done, generating RuleTable.c now, and finishing compilation."
 ./YAN NAL_GenerateRuleTable > ./src/RuleTable.c
 gcc $1 -ffunction-sections -fdata-sections -Wl,--gc-sections -Wl,--print-gc-sections -DSTAGE=2 $BaseFlags src/RuleTable.c
+echo "Building the embedding library libyan.a and libyan.so, see src/YAN.h for its API."
+LibFlags="-fopenmp -pthread -D_POSIX_C_SOURCE=199506L -pedantic -std=c99 -g3 -O3 -fPIC -DSTAGE=2"
+mkdir -p lib_obj
+for f in `ls src/*.c | grep -v main.c`; do gcc $1 -c $LibFlags $f -o lib_obj/`basename $f .c`.o; done
+rm -f libyan.a
+ar rcs libyan.a lib_obj/*.o
+gcc -shared -fopenmp -pthread lib_obj/*.o -lm -o libyan.so
+rm -r lib_obj
 echo "Done."
@@ -3,22 +3,20 @@
 #...[[[adj] subject] ... [adv] predicate] ... [adj] object ... [prep adj object2] conj
 
 #pip install nltk
+#The reasoner runs in-process through the yan extension module, see yan_shell.py
 import sys
-import thread
-import time
-from subprocess import Popen, PIPE, STDOUT
-import subprocess
 import nltk as nltk
 from nltk import sent_tokenize, word_tokenize
 from nltk.corpus import stopwords
 from nltk import WordNetLemmatizer
 from nltk.corpus import wordnet
+import yan_shell
 
 nltk.download('punkt')
 nltk.download('averaged_perceptron_tagger')
 nltk.download('universal_tagset')
 nltk.download('wordnet')
-proc = subprocess.Popen(["./YAN","shell"], stdin=subprocess.PIPE, stdout=subprocess.PIPE)
+shell = None
 
 #convert universal tag set to the wordnet word types
 def wordnet_tag(tag):
@@ -51,8 +49,13 @@ def output(text):
         text = text.replace(x, "?1")
     text = text.replace("what","?1").replace("where","?1").replace("which","?1").replace("when","?1").replace("who","?1")
     print(text)
+    narsese(text)
+
+#pass a line to the reasoner, printing its output
+def narsese(line):
+    for out in shell.process(line):
+        print(out)
     sys.stdout.flush()
-    proc.stdin.write(text + "\n")
     
 #return word type for a word, treating question words (who, what etc.) also as nouns
 def isWordType(word, wordtype):
@@ -63,29 +66,20 @@ def isWordType(word, wordtype):
             return True
         return wordtype == wordtypes[word]
 
-def receive_thread(a):
-    while True:
-        newstr = proc.stdout.readline().strip()
-        if newstr != "":
-            print(newstr)
-            sys.stdout.flush()
-       
-thread.start_new_thread(receive_thread,(1,))
-sys.stdout.flush()
-timeout = 0
-while True:
-    try:
-        sentence = raw_input()
-    except: #exit but let reasoning finish according to the steps in the file using pessmistic estimation:
-        time.sleep(1+timeout/100) #to not exit before: 100 steps per second should be doable! :)
-        exit(0) #eof from cat (TODO check in a better way, TODO timeout can be done in a better way as well)
-    if sentence.strip().isdigit():
-        timeout += int(sentence.strip())
-        proc.stdin.write(sentence.strip() + "\n")
-        continue
-    if sentence.strip().startswith("*") or sentence.strip().startswith("//"):
-        proc.stdin.write(sentence.strip() + "\n")
-        continue
+#translate the English sentences to Narsese for a fresh reasoner
+def run(lines):
+    global shell, questionwords
+    shell = yan_shell.Shell()
+    questionwords = set([])
+    for sentence in lines:
+        sentence = sentence.rstrip("\n")
+        if sentence.strip().isdigit() or sentence.strip().startswith("*") or sentence.strip().startswith("//"):
+            narsese(sentence.strip())
+            continue
+        translate(sentence)
+
+def translate(sentence):
+    global wordtypes
     print("Input sentence: " + sentence)
     (words, wordtypes) = words_and_types(sentence + " and")
     punctuation = "?" if "?" in sentence else "."
@@ -159,3 +153,6 @@ while True:
                     object_modifiers = "_object_"
             else:
                 sys.stdout.flush()
+
+if __name__ == "__main__":
+    run(sys.stdin)
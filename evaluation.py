@@ -1,6 +1,8 @@
 from subprocess import PIPE, run
-import subprocess
+import contextlib
 import glob
+import io
+import yan_shell #the examples run in-process, build the module with "python3 setup.py build_ext --inplace"
 
 #YAN C tests & metrics, only print fully output on failure, always print the metrics:
 def ctests(Example, Args, DoneAfterMetric):
@@ -111,12 +113,16 @@ def Test(Example, outputString):
 #Evaluate tests & performance on all Narsese examples:
 print("\nNow running Q&A experiments:")
 for filename in glob.glob("./examples/nal/*.nal"):
-    Test(filename, subprocess.getoutput("./YAN shell < " + filename))
+    Test(filename, yan_shell.Run(open(filename)))
 print("\nNarsese integration tests successful!")
 
 #Evaluate tests & performance English examples:
+import english_shell
 for filename in glob.glob('./examples/english/*.english'):
-    Test(filename, subprocess.getoutput("python2 english_shell.py < " + filename))
+    englishOutput = io.StringIO()
+    with contextlib.redirect_stdout(englishOutput):
+        english_shell.run(open(filename))
+    Test(filename, englishOutput.getvalue())
 print("\nEnglish integration tests successful!")
 
 #Print global metrics:
@@ -0,0 +1,283 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//////////////////////////
+//  Python extension    //
+//////////////////////////
+//The yan module, an in-process binding of the embedding API in src/YAN.h:
+//    import yan
+//    yan.init()
+//    nar = yan.NAR()
+//    nar.add_operation("^left", lambda operation, args: print(operation, args))
+//    nar.add_input("<a --> b>.")
+//    nar.cycles(10)
+//    answer = nar.ask("<a --> ?1>?")
+//    for derivation in nar.derivations(): ...
+//The GIL is released while the reasoner runs, so several instances can run in parallel threads.
+
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+#include "YAN.h"
+
+typedef struct
+{
+    PyObject_HEAD
+    YAN *yan;
+    PyObject *operations; //callables by operation name
+} YANModule_NAR;
+
+static PyObject *YANModule_Init(PyObject *self, PyObject *args)
+{
+    YAN_Init();
+    Py_RETURN_NONE;
+}
+
+//Invoked during cycles, without the GIL
+static void YANModule_Operation(YAN *yan, const char *operation, const char *args, void *userdata)
+{
+    YANModule_NAR *nar = userdata;
+    PyGILState_STATE gil = PyGILState_Ensure();
+    if(!PyErr_Occurred()) //after a failed callback the error is raised once the cycles are done
+    {
+        PyObject *callback = PyDict_GetItemString(nar->operations, operation);
+        if(callback != NULL)
+        {
+            PyObject *result = PyObject_CallFunction(callback, "ss", operation, args);
+            Py_XDECREF(result);
+        }
+    }
+    PyGILState_Release(gil);
+}
+
+static PyObject *YANModule_NAR_New(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+    YANModule_NAR *nar = (YANModule_NAR*) type->tp_alloc(type, 0);
+    if(nar == NULL)
+    {
+        return NULL;
+    }
+    nar->operations = PyDict_New();
+    if(nar->operations == NULL)
+    {
+        Py_DECREF(nar);
+        return NULL;
+    }
+    nar->yan = YAN_New();
+    return (PyObject*) nar;
+}
+
+static void YANModule_NAR_Dealloc(YANModule_NAR *nar)
+{
+    if(nar->yan != NULL)
+    {
+        YAN_Free(nar->yan);
+    }
+    Py_XDECREF(nar->operations);
+    Py_TYPE(nar)->tp_free((PyObject*) nar);
+}
+
+static PyObject *YANModule_NAR_AddInput(YANModule_NAR *nar, PyObject *args)
+{
+    const char *narsese;
+    if(!PyArg_ParseTuple(args, "s", &narsese))
+    {
+        return NULL;
+    }
+    bool added;
+    Py_BEGIN_ALLOW_THREADS
+    added = YAN_AddInput(nar->yan, narsese);
+    Py_END_ALLOW_THREADS
+    if(PyErr_Occurred())
+    {
+        return NULL;
+    }
+    return PyBool_FromLong(added);
+}
+
+static PyObject *YANModule_NAR_Cycles(YANModule_NAR *nar, PyObject *args)
+{
+    int cycles;
+    if(!PyArg_ParseTuple(args, "i", &cycles))
+    {
+        return NULL;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    YAN_Cycles(nar->yan, cycles);
+    Py_END_ALLOW_THREADS
+    if(PyErr_Occurred())
+    {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *YANModule_NAR_Time(YANModule_NAR *nar, PyObject *args)
+{
+    return PyLong_FromLong(YAN_Time(nar->yan));
+}
+
+static PyObject *YANModule_NAR_Reset(YANModule_NAR *nar, PyObject *args)
+{
+    YAN_Reset(nar->yan);
+    Py_RETURN_NONE;
+}
+
+static PyObject *YANModule_NAR_AddOperation(YANModule_NAR *nar, PyObject *args)
+{
+    const char *operation;
+    PyObject *callback;
+    if(!PyArg_ParseTuple(args, "sO", &operation, &callback))
+    {
+        return NULL;
+    }
+    if(!PyCallable_Check(callback))
+    {
+        PyErr_SetString(PyExc_TypeError, "The operation callback has to be callable");
+        return NULL;
+    }
+    if(!YAN_AddOperation(nar->yan, operation, YANModule_Operation, nar))
+    {
+        PyErr_Format(PyExc_ValueError, "Operation can't be registered: %s", operation);
+        return NULL;
+    }
+    if(PyDict_SetItemString(nar->operations, operation, callback) < 0)
+    {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+static PyObject *YANModule_NAR_Ask(YANModule_NAR *nar, PyObject *args)
+{
+    const char *question;
+    if(!PyArg_ParseTuple(args, "s", &question))
+    {
+        return NULL;
+    }
+    YAN_Answer answer;
+    int result;
+    Py_BEGIN_ALLOW_THREADS
+    result = YAN_Ask(nar->yan, question, &answer);
+    Py_END_ALLOW_THREADS
+    if(result == YAN_MALFORMED)
+    {
+        PyErr_Format(PyExc_ValueError, "Malformed question: %s", question);
+        return NULL;
+    }
+    if(result == YAN_UNANSWERED)
+    {
+        Py_RETURN_NONE;
+    }
+    return Py_BuildValue("{s:s,s:O,s:l,s:l,s:d,s:d}", "term", answer.term, "isEvent", answer.isEvent ? Py_True : Py_False,
+                         "occurrenceTime", answer.occurrenceTime, "creationTime", answer.creationTime,
+                         "frequency", answer.frequency, "confidence", answer.confidence);
+}
+
+static PyObject *YANModule_NAR_Derivations(YANModule_NAR *nar, PyObject *args)
+{
+    PyObject *derivations = PyList_New(0);
+    if(derivations == NULL)
+    {
+        return NULL;
+    }
+    YAN_Knowledge k;
+    while(YAN_NextDerivation(nar->yan, &k))
+    {
+        PyObject *derivation = Py_BuildValue("{s:s,s:C,s:O,s:l,s:d,s:d,s:d,s:O,s:O,s:O,s:O}", "term", k.term, "punctuation", k.punctuation,
+                                             "isEvent", k.isEvent ? Py_True : Py_False, "occurrenceTime", k.occurrenceTime,
+                                             "frequency", k.frequency, "confidence", k.confidence, "priority", k.priority,
+                                             "input", (k.flags & YAN_INPUT) ? Py_True : Py_False,
+                                             "derived", (k.flags & YAN_DERIVED) ? Py_True : Py_False,
+                                             "revised", (k.flags & YAN_REVISED) ? Py_True : Py_False,
+                                             "implication", (k.flags & YAN_IMPLICATION) ? Py_True : Py_False);
+        if(derivation == NULL || PyList_Append(derivations, derivation) < 0)
+        {
+            Py_XDECREF(derivation);
+            Py_DECREF(derivations);
+            return NULL;
+        }
+        Py_DECREF(derivation);
+    }
+    return derivations;
+}
+
+static PyMethodDef YANModule_NAR_Methods[] =
+{
+    {"add_input", (PyCFunction) YANModule_NAR_AddInput, METH_VARARGS, "Adds a belief or goal in Narsese and performs a cycle, returns False if malformed or a question"},
+    {"cycles", (PyCFunction) YANModule_NAR_Cycles, METH_VARARGS, "Performs inference cycles"},
+    {"time", (PyCFunction) YANModule_NAR_Time, METH_NOARGS, "Current time in cycles"},
+    {"reset", (PyCFunction) YANModule_NAR_Reset, METH_NOARGS, "Resets the memory, keeping the operations"},
+    {"add_operation", (PyCFunction) YANModule_NAR_AddOperation, METH_VARARGS, "Registers a callable(operation, args) for an operation starting with ^"},
+    {"ask", (PyCFunction) YANModule_NAR_Ask, METH_VARARGS, "Answers a question in Narsese with a dict, None if there is no answer"},
+    {"derivations", (PyCFunction) YANModule_NAR_Derivations, METH_NOARGS, "Takes the buffered added knowledge as list of dicts"},
+    {NULL}
+};
+
+static PyTypeObject YANModule_NARType =
+{
+    PyVarObject_HEAD_INIT(NULL, 0)
+    .tp_name = "yan.NAR",
+    .tp_doc = "Reasoner instance",
+    .tp_basicsize = sizeof(YANModule_NAR),
+    .tp_flags = Py_TPFLAGS_DEFAULT,
+    .tp_new = YANModule_NAR_New,
+    .tp_dealloc = (destructor) YANModule_NAR_Dealloc,
+    .tp_methods = YANModule_NAR_Methods,
+};
+
+static PyMethodDef YANModule_Methods[] =
+{
+    {"init", YANModule_Init, METH_NOARGS, "Initializes the library, resetting the vocabulary, to be called before creating instances"},
+    {NULL}
+};
+
+static struct PyModuleDef YANModule =
+{
+    PyModuleDef_HEAD_INIT,
+    .m_name = "yan",
+    .m_doc = "In-process binding of the YAN reasoner",
+    .m_size = -1,
+    .m_methods = YANModule_Methods,
+};
+
+PyMODINIT_FUNC PyInit_yan()
+{
+    if(PyType_Ready(&YANModule_NARType) < 0)
+    {
+        return NULL;
+    }
+    PyObject *module = PyModule_Create(&YANModule);
+    if(module == NULL)
+    {
+        return NULL;
+    }
+    Py_INCREF(&YANModule_NARType);
+    if(PyModule_AddObject(module, "NAR", (PyObject*) &YANModule_NARType) < 0)
+    {
+        Py_DECREF(&YANModule_NARType);
+        Py_DECREF(module);
+        return NULL;
+    }
+    return module;
+}
@@ -0,0 +1,7 @@
+#Builds the yan Python extension module, after build.sh built libyan.a:
+#python3 setup.py build_ext --inplace
+from setuptools import setup, Extension
+
+setup(name = "yan",
+      ext_modules = [Extension("yan", sources = ["python/YANModule.c"], include_dirs = ["src"],
+                               extra_objects = ["libyan.a"], extra_link_args = ["-fopenmp", "-pthread"], libraries = ["m"])])
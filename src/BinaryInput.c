@@ -0,0 +1,163 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "BinaryInput.h"
+
+//Maps client IDs to atoms, 0 if not registered
+static Atom BinaryInput_atoms[BINARY_INPUT_CLIENT_IDS_MAX];
+
+void BinaryInput_INIT()
+{
+    memset(BinaryInput_atoms, 0, sizeof(BinaryInput_atoms));
+}
+
+bool BinaryInput_RegisterAtom(int clientID, char *name)
+{
+    Term term;
+    if(clientID <= 0 || clientID >= BINARY_INPUT_CLIENT_IDS_MAX || !Narsese_ParseTerm(name, &term) || term.atoms[1] != 0)
+    {
+        return false;
+    }
+    BinaryInput_atoms[clientID] = term.atoms[0];
+    return true;
+}
+
+static bool BinaryInput_Read(FILE *in, void *dest, size_t size)
+{
+    return fread(dest, 1, size, in) == size;
+}
+
+bool BinaryInput_ReadFrame(FILE *in, BinaryInput_Frame *frame)
+{
+    for(;;)
+    {
+        uint8_t type;
+        if(!BinaryInput_Read(in, &type, 1))
+        {
+            return false; //end of stream
+        }
+        if(type == 'R')
+        {
+            uint8_t header[2];
+            char name[ATOMIC_TERM_LEN_MAX] = {0};
+            if(!BinaryInput_Read(in, header, 2) || header[1] >= ATOMIC_TERM_LEN_MAX || !BinaryInput_Read(in, name, header[1]) ||
+               !BinaryInput_RegisterAtom(header[0], name))
+            {
+                return false;
+            }
+            Output_Printf("Registered: %d %s\n", header[0], name);
+            continue;
+        }
+        frame->type = type;
+        if(type == 'C')
+        {
+            return BinaryInput_Read(in, &frame->cycles, sizeof(uint32_t));
+        }
+        if(type != 'E')
+        {
+            return false;
+        }
+        uint8_t header[2], n;
+        float truth[2];
+        Atom clientAtoms[COMPOUND_TERM_SIZE_MAX];
+        if(!BinaryInput_Read(in, header, 2) || !BinaryInput_Read(in, truth, sizeof(truth)) || !BinaryInput_Read(in, &n, 1) ||
+           n > COMPOUND_TERM_SIZE_MAX || !BinaryInput_Read(in, clientAtoms, n))
+        {
+            return false;
+        }
+        frame->punctuation = header[0];
+        frame->isEvent = header[1];
+        frame->truth = Truth_New(truth[0], truth[1]);
+        if((frame->punctuation != '.' && frame->punctuation != '!') || n == 0 || 
+           truth[0] < 0.0 || truth[0] > 1.0 || truth[1] < 0.0 || truth[1] > 1.0)
+        {
+            return false;
+        }
+        frame->term = (Term) {0};
+        for(int i=0; i<n; i++)
+        {
+            int clientID = (uint8_t) clientAtoms[i];
+            frame->term.atoms[i] = BinaryInput_atoms[clientID];
+            if(clientID && !frame->term.atoms[i])
+            {
+                return false; //client ID wasn't registered
+            }
+        }
+        return frame->term.atoms[0] != 0;
+    }
+}
+
+void BinaryInput_ApplyFrame(NAR *nar, BinaryInput_Frame *frame)
+{
+    if(frame->type == 'C')
+    {
+        NAR_Cycles(nar, frame->cycles);
+        return;
+    }
+#if STAGE==2
+    //apply reduction rules to term:
+    frame->term = RuleTable_Reduce(frame->term, false);
+#endif
+    NAR_AddInput(nar, frame->term, frame->punctuation == '!' ? EVENT_TYPE_GOAL : EVENT_TYPE_BELIEF, frame->truth, !frame->isEvent);
+}
+
+void BinaryInput_WriteRegistration(FILE *out, int clientID, char *name)
+{
+    uint8_t header[3] = { 'R', clientID, strlen(name) };
+    fwrite(header, 1, 3, out);
+    fwrite(name, 1, header[2], out);
+}
+
+void BinaryInput_WriteEvent(FILE *out, Term *term, char punctuation, bool isEvent, Truth truth)
+{
+    uint8_t n = COMPOUND_TERM_SIZE_MAX;
+    for(; n>0 && !term->atoms[n-1]; n--);
+    uint8_t header[3] = { 'E', punctuation, isEvent };
+    float tv[2] = { Truth_Frequency(truth), Truth_Confidence(truth) };
+    fwrite(header, 1, 3, out);
+    fwrite(tv, sizeof(float), 2, out);
+    fwrite(&n, 1, 1, out);
+    fwrite(term->atoms, 1, n, out);
+}
+
+void BinaryInput_WriteCycles(FILE *out, uint32_t cycles)
+{
+    fputc('C', out);
+    fwrite(&cycles, sizeof(uint32_t), 1, out);
+}
+
+void BinaryInput_Start(NAR *nar)
+{
+    BinaryInput_INIT();
+    BinaryInput_Frame frame;
+    while(BinaryInput_ReadFrame(stdin, &frame))
+    {
+        BinaryInput_ApplyFrame(nar, &frame);
+    }
+    if(!feof(stdin))
+    {
+        Output_Puts("Binary input error: malformed frame\n");
+    }
+    Stats_Print(nar);
+}
@@ -0,0 +1,79 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_BINARYINPUT
+#define H_BINARYINPUT
+
+//////////////////////////
+//  Binary event input  //
+//////////////////////////
+//Compact framing for high-rate event streams, avoids rendering and reparsing Narsese text.
+//All multi-byte fields are in host byte order, frames are:
+//'R' u8 clientID, u8 len, char name[len]: registers an atom name under a client-chosen ID 1..255,
+//                                         answered with "Registered: <clientID> <name>" on stdout
+//'E' u8 punctuation, u8 isEvent, f32 frequency, f32 confidence, u8 n, u8 atoms[n]:
+//                                         belief '.' or goal '!', atoms are client IDs of the term encoding (0 is empty)
+//'C' u32 cycles:                          runs the NAR for the given amount of cycles
+
+//References//
+//-----------//
+#include <stdio.h>
+#include <stdint.h>
+#include "NAR.h"
+#include "Stats.h"
+
+//Parameters//
+//----------//
+#define BINARY_INPUT_CLIENT_IDS_MAX 256
+
+//Data structure//
+//--------------//
+typedef struct
+{
+    char type; //'E' or 'C', registrations are handled while reading
+    Term term;
+    char punctuation;
+    bool isEvent;
+    Truth truth;
+    uint32_t cycles;
+} BinaryInput_Frame;
+
+//Methods//
+//-------//
+//Clears the atom registrations
+void BinaryInput_INIT();
+//Registers an atom name for a client ID, returns false if the name isn't an atom or the ID is invalid
+bool BinaryInput_RegisterAtom(int clientID, char *name);
+//Reads the next frame, handling registrations on the way, returns false on end of stream or malformed frame
+bool BinaryInput_ReadFrame(FILE *in, BinaryInput_Frame *frame);
+//Adds the event of the frame to the NAR, or runs its cycles
+void BinaryInput_ApplyFrame(NAR *nar, BinaryInput_Frame *frame);
+//Writers for clients, the term atoms are client IDs
+void BinaryInput_WriteRegistration(FILE *out, int clientID, char *name);
+void BinaryInput_WriteEvent(FILE *out, Term *term, char punctuation, bool isEvent, Truth truth);
+void BinaryInput_WriteCycles(FILE *out, uint32_t cycles);
+//Reads frames from stdin till the end of the stream
+void BinaryInput_Start(NAR *nar);
+
+#endif
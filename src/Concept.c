@@ -24,18 +24,10 @@
 
 #include "Concept.h"
 
-void Concept_SetTerm(Concept *concept, Term term)
-{
-    concept->term = term;
-    //Generate hash too:
-    concept->term_hash = Term_Hash(&term) % CONCEPTS_MAX;
-}
-
-void Concept_Print(Concept *concept)
+void Concept_Print(TermStore *terms, Concept *concept)
 {
     puts("Concept:");
-    Term_Print(&concept->term);
-    Usage_Print(&concept->usage);
+    Term_Print(TermStore_Term(terms, concept->term));
     puts("");
 }
 
@@ -35,28 +35,38 @@
 #include "FIFO.h"
 #include "Table.h"
 #include "Usage.h"
+#include "TermStore.h"
 
 //Data structure//
 //--------------//
+//The implication table of an operation, allocated when the concept is the postcondition of an implication with the operation
+typedef struct {
+    Table table; //first, so that the table can be taken as the OperationTable
+    int operationID;
+    int next; //next table of the concept with higher operation ID, 0 if none
+} OperationTable;
+//Flags of a concept, kept with its other frequently read fields by the memory
+#define CONCEPT_FLAG_VARIABLES 1 //the term has variables
+#define CONCEPT_FLAG_INCOMING_GOAL_SPIKE 2 //the incoming goal spike is set
+#define CONCEPT_FLAG_GOAL_SPIKE 4 //the goal spike is set
+#define CONCEPT_FLAG_IMPLICATIONS 8 //implications were added to the tables of the concept
+//The term, beliefs and tables of a concept, its priority, usage and flags are kept in the hot arrays of the memory
 typedef struct {
     long id;
-    Usage usage;
-    Term term;
-    TERM_HASH_TYPE term_hash;
+    TermHandle term; //interned in the term store of the memory
     Event belief; //the highest confident eternal belief
     Event belief_spike;
     Event predicted_belief;
     Event incoming_goal_spike;
     Event goal_spike;
-    Table precondition_beliefs[OPERATIONS_MAX];
-    double priority;
+    Table precondition_beliefs; //of the implications without operation
+    int operation_tables; //first table of the implications with operation, ordered by operation ID, 0 if none
+    int sourcedImplications; //implications in the tables of the concepts which have this concept as source
 } Concept;
 
 //Methods//
 //-------//
-//Assign a new name to a concept
-void Concept_SetTerm(Concept *concept, Term term);
 //print a concept
-void Concept_Print(Concept *concept);
+void Concept_Print(TermStore *terms, Concept *concept);
 
 #endif
@@ -40,6 +40,22 @@
 #define PROPAGATION_THRESHOLD_INITIAL 0.501
 //How many propagation iterations happen per cycle
 #define PROPAGATION_ITERATIONS 5
+//Whether subgoals are expanded best-first by desire, memoised across cycles, instead of propagating spikes
+#define BEST_FIRST_PLANNING_INITIAL false
+//How many subgoals the best-first planner expands per cycle
+#define PLANNING_EXPANSION_BUDGET_INITIAL 16
+//Maximum amount of subgoals of a goal the best-first planner keeps
+#define PLAN_SIZE 64
+//Amount of goals the best-first planner memoises the subgoals of
+#define PLANS_MAX 8
+//Wall-clock budget of a cycle in milliseconds in real-time mode, 0 for no budget
+#define CYCLE_BUDGET_MS_INITIAL 0
+//Amount of concepts a thread infers with between deadline checks in real-time mode
+#define CYCLE_DEADLINE_CHECK_INTERVAL 16
+//Resolution of the priority order of the concepts in real-time mode
+#define CYCLE_PRIORITY_BUCKETS 256
+//Whether cycles without events, goals or input to process are skipped at once, with their forgetting applied in closed form
+#define CYCLE_FAST_FORWARD_INITIAL true
 
 /*---------------------*/
 /* Decision parameters */
@@ -56,6 +72,12 @@
 /*----------------------*/
 //Event selections per cycle for inference
 #define EVENT_SELECTIONS 1
+//Active goals processed per cycle, their spikes are propagated together
+#define GOAL_SELECTIONS 4
+//Goal priority decay of active goals per cycle
+#define GOAL_DURABILITY 0.9
+//Active goals with a lower priority are dropped
+#define GOAL_PRIORITY_MIN 0.3
 //Event priority decay of events per cycle
 #define EVENT_DURABILITY 1.0
 //Additional event priority decay of an event which was selected
@@ -78,10 +100,24 @@
 /*------------------*/
 //Maximum amount of concepts
 #define CONCEPTS_MAX 16384
+//Maximum amount of interned terms, each concept holds the one of its term
+#define INTERNED_TERMS_MAX CONCEPTS_MAX
+//Hash buckets of the interned terms
+#define INTERNED_TERMS_BUCKETS CONCEPTS_MAX
 //Maximum amount of events attention buffer holds
 #define CYCLING_EVENTS_MAX 20
-//Maximum amount of operations which can be registered
-#define OPERATIONS_MAX 10
+//Hash buckets for recognizing events which are in the attention buffer already
+#define CYCLING_EVENTS_BUCKETS (2*CYCLING_EVENTS_MAX)
+//Priority levels of the attention buffer
+#define EVENT_BAG_LEVELS 100
+//Maximum amount of active goals
+#define GOALS_MAX 20
+//Maximum amount of operators, these are atoms, the registries only grow with the operations registered
+#define OPERATIONS_MAX TERMS_MAX
+//Implication tables of the operations are allocated in chunks of this many tables, shared by the concepts
+#define OPERATION_TABLES_CHUNK_SIZE 64
+//Maximum amount of chunks of implication tables of the operations
+#define OPERATION_TABLES_CHUNKS_MAX 4096
 //Maximum size of the stamp in terms of evidental base id's
 #define STAMP_SIZE 20
 //Maximum event FIFO size
@@ -100,6 +136,44 @@
 #define ATOMIC_TERM_LEN_MAX 30
 //Maximum size of Narsese input in terms of characters
 #define NARSESE_LEN_MAX 1000
+//Size of the input and execution queues of a NAR instance, must be a power of two
+#define EVENT_QUEUE_SIZE 1024
+
+/*-------------------*/
+/* Output parameters */
+/*-------------------*/
+//Size of the output ring buffer in bytes
+#define OUTPUT_BUFFER_SIZE (1 << 20)
+//Maximum length of an output line, longer ones are committed in parts
+#define OUTPUT_LINE_MAX 1024
+//Flush policy of the output writer thread
+#define OUTPUT_FLUSH_POLICY_INITIAL OUTPUT_FLUSH_DRAINED
+//Flush interval for OUTPUT_FLUSH_INTERVAL
+#define OUTPUT_FLUSH_INTERVAL_MS 100
+//Whether derivations may be dropped when the output buffer is full
+#define OUTPUT_BOUNDED_LOSS_INITIAL false
+//Sleep time of the writer thread when idle, and of the producer when the buffer is full
+#define OUTPUT_WRITER_SLEEP_US 200
+//Whether output is written at all, embedders switch it off as they receive results through the API
+#define OUTPUT_ENABLED_INITIAL true
+
+/*------------------*/
+/* Trace parameters */
+/*------------------*/
+//Only every n-th record is traced, to keep tracing cheap in production
+#define TRACE_SAMPLING_INITIAL 1
+
+/*-----------------*/
+/* Numeric profile */
+/*-----------------*/
+//Representation of the stored truth values and priorities, see Numeric in Globals.h
+#define NUMERIC_DOUBLE 0
+#define NUMERIC_FLOAT 1
+#define NUMERIC_FIXED16 2
+//Float or 16-bit fixed point reduce the footprint and memory bandwidth on embedded targets, select with -DNUMERIC_PROFILE=...
+#ifndef NUMERIC_PROFILE
+#define NUMERIC_PROFILE NUMERIC_DOUBLE
+#endif
 
 /*------------------*/
 /* Truth parameters */
@@ -114,6 +188,10 @@
 #define TRUTH_EVIDENTAL_HORIZON_INITIAL 1.0
 //Time distance based projection decay of event truth
 #define TRUTH_PROJECTION_DECAY_INITIAL 0.8
+//Time distances the projection decay is tabulated for, larger ones are computed
+#define TRUTH_PROJECTION_TABLE_SIZE 1024
+//Maximum amount of truth values processed by one call of a batch truth function
+#define TRUTH_BATCH_SIZE 64
 //Maximum value for confidence
 #define MAX_CONFIDENCE 0.99
 
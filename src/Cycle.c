@@ -23,27 +23,77 @@
  */
 
 #include "Cycle.h"
+#include "Planner.h"
+
+double CYCLE_BUDGET_MS = CYCLE_BUDGET_MS_INITIAL;
+bool CYCLE_FAST_FORWARD = CYCLE_FAST_FORWARD_INITIAL;
+
+static double Cycle_Milliseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+//Whether the deadline of the cycle passed, marking the cycle as truncated if so
+static bool Cycle_DeadlinePassed(double deadline, bool *truncated)
+{
+    if(Cycle_Milliseconds() >= deadline)
+    {
+        __atomic_store_n(truncated, true, __ATOMIC_RELAXED);
+        return true;
+    }
+    return false;
+}
+
+#if STAGE==2
+//Orders the concepts by descending priority for anytime inference, bucket sorted as the priorities are within [0, 1]
+static void Cycle_OrderConceptsByPriority(NAR *nar)
+{
+    int bucketStart[CYCLE_PRIORITY_BUCKETS+1] = {0};
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
+    {
+        double priority = Numeric_ToReal(nar->concept_priority[nar->concepts.items[i].handle]);
+        int bucket = CYCLE_PRIORITY_BUCKETS-1 - (int) (MIN(1.0, MAX(0.0, priority)) * (CYCLE_PRIORITY_BUCKETS-1));
+        bucketStart[bucket+1]++;
+    }
+    for(int b=0; b<CYCLE_PRIORITY_BUCKETS; b++)
+    {
+        bucketStart[b+1] += bucketStart[b];
+    }
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
+    {
+        double priority = Numeric_ToReal(nar->concept_priority[nar->concepts.items[i].handle]);
+        int bucket = CYCLE_PRIORITY_BUCKETS-1 - (int) (MIN(1.0, MAX(0.0, priority)) * (CYCLE_PRIORITY_BUCKETS-1));
+        nar->conceptsByPriority[bucketStart[bucket]++] = nar->concepts.items[i].address;
+    }
+    nar->conceptsByPriorityAmount = nar->concepts.itemsAmount;
+}
+#endif
 
 //doing inference within the matched concept, returning whether decisionMaking should continue
-static Decision Cycle_ActivateConcept(Concept *c, Event *e, long currentTime)
+static Decision Cycle_ActivateConcept(NAR *nar, Concept *c, Event *e, long currentTime)
 {
     Decision decision = {0};
     Event eMatch = *e;
-    if(eMatch.truth.confidence > MIN_CONFIDENCE)
+    if(Truth_Confidence(eMatch.truth) > MIN_CONFIDENCE)
     {
-        c->usage = Usage_use(c->usage, currentTime);
+        int slot = Memory_ConceptSlot(nar, c);
+        nar->concept_usage[slot] = Usage_use(nar->concept_usage[slot], currentTime);
         //add event as spike to the concept:
         if(eMatch.type == EVENT_TYPE_BELIEF)
         {
             c->belief_spike = eMatch;
+            Query_UpdateBelief(nar, &c->belief_spike, true, currentTime);
         }
         else
         {
             //pass spike if the concept doesn't have a satisfying motor command
-            decision = Decision_Suggest(&eMatch, currentTime);
+            decision = Decision_Suggest(nar, &eMatch, currentTime);
             if(!decision.execute)
             {
                 c->incoming_goal_spike = eMatch;
+                nar->concept_flags[slot] |= CONCEPT_FLAG_INCOMING_GOAL_SPIKE;
             }
             else
             {
@@ -55,27 +105,34 @@ static Decision Cycle_ActivateConcept(Concept *c, Event *e, long currentTime)
 }
 
 //Process an event, by creating a concept, or activating an existing
-static Decision Cycle_ProcessEvent(Event *e, long currentTime)
+static Decision Cycle_ProcessEvent(NAR *nar, Event *e, long currentTime)
 {
     Decision best_decision = {0};
     //add a new concept for e if not yet existing
-    Memory_Conceptualize(&e->term, currentTime);
+    Memory_Conceptualize(nar, &e->term, currentTime);
     e->processed = true;
     Event_SetTerm(e, e->term); // TODO make sure that hash needs to be calculated once instead already
     IN_DEBUG( puts("Event was selected:"); Event_Print(e); )
     //determine the concept it is related to
     Event ecp = *e;
-    for(int concept_i=0; concept_i<concepts.itemsAmount; concept_i++)
+    bool eventHasVariable = Variable_hasVariable(&e->term, true, true, true);
+    TERM_HASH_TYPE eventHash = Term_Hash(&e->term);
+    for(int concept_i=0; concept_i<nar->concepts.itemsAmount; concept_i++)
     {
-        Concept *c = concepts.items[concept_i].address;
-        if(!Variable_hasVariable(&e->term, true, true, true))  //concept matched to the event which doesn't have variables
+        int slot = nar->concepts.items[concept_i].handle;
+        Concept *c = nar->concepts.items[concept_i].address;
+        if(!eventHasVariable)  //concept matched to the event which doesn't have variables
         {
-            Substitution subs = Variable_Unify(&c->term, &e->term); //concept with variables, 
+            if(!(nar->concept_flags[slot] & CONCEPT_FLAG_VARIABLES) && nar->concept_term_hash[slot] != eventHash)
+            {
+                continue; //without variables the concept term can only match an equal term
+            }
+            Substitution subs = Variable_Unify(Memory_ConceptTerm(nar, c), &e->term); //concept with variables, 
             if(subs.success)
             {
                 ecp.term = e->term;
-                Concept *c = concepts.items[concept_i].address;
-                Decision decision = Cycle_ActivateConcept(c, &ecp, currentTime);
+                Concept *c = nar->concepts.items[concept_i].address;
+                Decision decision = Cycle_ActivateConcept(nar, c, &ecp, currentTime);
                 if(decision.execute && decision.desire >= best_decision.desire)
                 {
                     best_decision = decision;
@@ -84,12 +141,12 @@ static Decision Cycle_ProcessEvent(Event *e, long currentTime)
         }
         else
         {
-            Substitution subs = Variable_Unify(&e->term, &c->term); //event with variable matched to concept
+            Substitution subs = Variable_Unify(&e->term, Memory_ConceptTerm(nar, c)); //event with variable matched to concept
             if(subs.success)
             {
                 ecp.term = Variable_ApplySubstitute(e->term, subs);
-                Concept *c = concepts.items[concept_i].address;
-                Decision decision = Cycle_ActivateConcept(c, &ecp, currentTime);
+                Concept *c = nar->concepts.items[concept_i].address;
+                Decision decision = Cycle_ActivateConcept(nar, c, &ecp, currentTime);
                 if(decision.execute && decision.desire >= best_decision.desire)
                 {
                     best_decision = decision;
@@ -101,26 +158,26 @@ static Decision Cycle_ProcessEvent(Event *e, long currentTime)
 }
 
 //Propagate spikes for subgoal processing, generating anticipations and decisions
-static Decision Cycle_PropagateSpikes(long currentTime)
+static Decision Cycle_PropagateSpikes(NAR *nar, long currentTime)
 {
     Decision decision = {0};
     //pass goal spikes on to the next
-    for(int i=0; i<concepts.itemsAmount; i++)
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
     {
-        Concept *postc = concepts.items[i].address;
+        if(!(nar->concept_flags[nar->concepts.items[i].handle] & CONCEPT_FLAG_GOAL_SPIKE))
+        {
+            continue;
+        }
+        Concept *postc = nar->concepts.items[i].address;
         if(postc->goal_spike.type != EVENT_TYPE_DELETED && !postc->goal_spike.propagated && Truth_Expectation(postc->goal_spike.truth) > PROPAGATION_THRESHOLD)
         {
-            for(int opi=0; opi<OPERATIONS_MAX; opi++)
+            int opi;
+            for(Table *table = Memory_NextPreconditionBeliefs(nar, postc, NULL, &opi); table != NULL; table = Memory_NextPreconditionBeliefs(nar, postc, table, &opi))
             {
-                for(int j=0; j<postc->precondition_beliefs[opi].itemsAmount; j++)
+                for(int j=0; j<table->itemsAmount; j++)
                 {
-                    Implication *imp = &postc->precondition_beliefs[opi].array[j];
-                    if(!Memory_ImplicationValid(imp))
-                    {
-                        Table_Remove(&postc->precondition_beliefs[opi], j);
-                        j--;
-                        continue;
-                    }
+                    Implication *imp = Table_At(table, j);
+                    IN_DEBUG( assert(Memory_ImplicationValid(imp), "Implications of recycled concepts should have been removed"); )
                     //no var, just send to source concept
                     if(!Variable_hasVariable(&imp->term, true, true, true))
                     {
@@ -128,6 +185,7 @@ static Decision Cycle_PropagateSpikes(long currentTime)
                         if(pre->incoming_goal_spike.type == EVENT_TYPE_DELETED || pre->incoming_goal_spike.processed)
                         {
                             pre->incoming_goal_spike = Inference_GoalDeduction(&postc->goal_spike, imp);
+                            nar->concept_flags[Memory_ConceptSlot(nar, pre)] |= CONCEPT_FLAG_INCOMING_GOAL_SPIKE;
                         }
                     }
                     //find proper source to send to!
@@ -140,15 +198,16 @@ static Decision Cycle_PropagateSpikes(long currentTime)
                         Term left_side_with_op = Term_ExtractSubterm(&imp->term, 1);
                         Term left_side = Narsese_GetPreconditionWithoutOp(&left_side_with_op);
                         Term left_side_substituted = Variable_ApplySubstitute(left_side, subs);
-                        for(int concept_i=0; concept_i<concepts.itemsAmount; concept_i++)
+                        for(int concept_i=0; concept_i<nar->concepts.itemsAmount; concept_i++)
                         {
-                            Concept *pre = concepts.items[concept_i].address;
-                            if(Variable_Unify(&pre->term, &left_side_substituted).success) //could be <a --> M>! matching to some <... =/> <$1 --> M>>.
+                            Concept *pre = nar->concepts.items[concept_i].address;
+                            if(Variable_Unify(Memory_ConceptTerm(nar, pre), &left_side_substituted).success) //could be <a --> M>! matching to some <... =/> <$1 --> M>>.
                             {
                                 if(pre->incoming_goal_spike.type == EVENT_TYPE_DELETED || pre->incoming_goal_spike.processed)
                                 {
                                     pre->incoming_goal_spike = Inference_GoalDeduction(&postc->goal_spike, imp);
                                     pre->incoming_goal_spike.term = left_side_substituted; //set term as well, it's a specific goal now as it got specialized!
+                                    nar->concept_flags[nar->concepts.items[concept_i].handle] |= CONCEPT_FLAG_INCOMING_GOAL_SPIKE;
                                 }
                             }
                         }
@@ -159,16 +218,25 @@ static Decision Cycle_PropagateSpikes(long currentTime)
         postc->goal_spike.propagated = true;
     }
     //process incoming goal spikes, invoking potential operations
-    for(int i=0; i<concepts.itemsAmount; i++)
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
     {
-        Concept *c = concepts.items[i].address;
+        int slot = nar->concepts.items[i].handle;
+        if(!(nar->concept_flags[slot] & CONCEPT_FLAG_INCOMING_GOAL_SPIKE))
+        {
+            continue;
+        }
+        Concept *c = nar->concepts.items[i].address;
         if(c->incoming_goal_spike.type != EVENT_TYPE_DELETED)
         {
             c->goal_spike = Inference_IncreasedActionPotential(&c->goal_spike, &c->incoming_goal_spike, currentTime, NULL);
-            Memory_printAddedEvent(&c->goal_spike, 1, false, true, false);
+            if(c->goal_spike.type != EVENT_TYPE_DELETED)
+            {
+                nar->concept_flags[slot] |= CONCEPT_FLAG_GOAL_SPIKE;
+            }
+            Memory_printAddedEvent(nar, &c->goal_spike, 1, false, true, false);
             if(c->goal_spike.type != EVENT_TYPE_DELETED && !c->goal_spike.processed && Truth_Expectation(c->goal_spike.truth) > PROPAGATION_THRESHOLD)
             {
-                Decision decision = Cycle_ProcessEvent(&c->goal_spike, currentTime);
+                Decision decision = Cycle_ProcessEvent(nar, &c->goal_spike, currentTime);
                 if(decision.execute)
                 {
                     return decision;
@@ -176,20 +244,21 @@ static Decision Cycle_PropagateSpikes(long currentTime)
             }
         }
         c->incoming_goal_spike = (Event) {0};
+        nar->concept_flags[slot] &= ~CONCEPT_FLAG_INCOMING_GOAL_SPIKE;
     }
     return decision;
 }
 
 //Reinforce link between concept a and b (creating it if non-existent)
-static void Cycle_ReinforceLink(Event *a, Event *b)
+static void Cycle_ReinforceLink(NAR *nar, Event *a, Event *b)
 {
     if(a->type != EVENT_TYPE_BELIEF || b->type != EVENT_TYPE_BELIEF)
     {
         return;
     }
     Term a_term_nop = Narsese_GetPreconditionWithoutOp(&a->term);
-    Concept *A = Memory_FindConceptByTerm(&a_term_nop);
-    Concept *B = Memory_FindConceptByTerm(&b->term);
+    Concept *A = Memory_FindConceptByTerm(nar, &a_term_nop);
+    Concept *B = Memory_FindConceptByTerm(nar, &b->term);
     if(A != NULL && B != NULL && A != B)
     {
         //temporal induction
@@ -198,90 +267,241 @@ static void Cycle_ReinforceLink(Event *a, Event *b)
             Implication precondition_implication = Inference_BeliefInduction(a, b);
             precondition_implication.sourceConcept = A;
             precondition_implication.sourceConceptId = A->id;
-            if(precondition_implication.truth.confidence >= MIN_CONFIDENCE)
+            precondition_implication.creationTime = nar->currentTime; //for evaluation
+            if(Truth_Confidence(precondition_implication.truth) >= MIN_CONFIDENCE)
             {
                 Term general_implication_term = IntroduceImplicationVariables(precondition_implication.term);
                 if(Variable_hasVariable(&general_implication_term, true, true, false))
                 {
-                    NAL_DerivedEvent(general_implication_term, OCCURRENCE_ETERNAL, precondition_implication.truth, precondition_implication.stamp, currentTime, 1, 1, NULL, 0);
+                    NAL_DerivedEvent(nar, general_implication_term, OCCURRENCE_ETERNAL, precondition_implication.truth, precondition_implication.stamp, nar->currentTime, 1, 1, NULL, 0, TRACE_RULE_VARIABLE_INTRODUCTION);
                 }
                 int operationID = Narsese_getOperationID(&a->term);
                 IN_DEBUG ( if(operationID != 0) { Narsese_PrintTerm(&precondition_implication.term); Truth_Print(&precondition_implication.truth); puts("\n"); getchar(); } )
                 IN_DEBUG( fputs("Formed implication: ", stdout); Implication_Print(&precondition_implication); )
-                Implication *revised_precon = Table_AddAndRevise(&B->precondition_beliefs[operationID], &precondition_implication);
+                Implication *revised_precon = Table_AddAndRevise(nar, Memory_PreconditionBeliefs(nar, B, operationID, true), &precondition_implication);
                 if(revised_precon != NULL)
                 {
-                    revised_precon->creationTime = currentTime; //for evaluation
-                    revised_precon->sourceConcept = A;
-                    revised_precon->sourceConceptId = A->id;
                     /*IN_DEBUG( if(true && revised_precon->term_hash != 0) { fputs("REVISED pre-condition implication: ", stdout); Implication_Print(revised_precon); } ) */
-                    Memory_printAddedImplication(&revised_precon->term, &revised_precon->truth, false, revised_precon->truth.confidence > precondition_implication.truth.confidence);
+                    Memory_printAddedImplication(nar, revised_precon, false, revised_precon->truth.confidence > precondition_implication.truth.confidence);
                 }
             }
         }
     }
 }
 
-void popEvents()
+void popEvents(NAR *nar)
 {
     for(int i=0; i<EVENT_SELECTIONS; i++)
     {
-        Event *e;
-        double priority = 0;
-        if(!PriorityQueue_PopMax(&cycling_events, (void**) &e, &priority))
+        //copied out as they are added in a batch, while processing, recycled storage would be invalid to use
+        if(!EventBag_PopMax(&nar->cycling_events, &nar->selectedEvents[nar->eventsSelected], &nar->selectedEventsPriority[nar->eventsSelected]))
         {
-            assert(cycling_events.itemsAmount == 0, "No item was popped, only acceptable reason is when it's empty");
             IN_DEBUG( puts("Selecting event failed, maybe there is no event left."); )
             break;
         }
-        selectedEventsPriority[eventsSelected] = priority;
-        selectedEvents[eventsSelected] = *e; //needs to be copied because will be added in a batch
-        eventsSelected++; //that while processing, would make recycled pointers invalid to use
+        nar->eventsSelected++;
+    }
+}
+
+void pushEvents(NAR *nar, long currentTime)
+{
+    for(int i=0; i<nar->eventsSelected; i++)
+    {
+        Memory_addEvent(nar, &nar->selectedEvents[i], currentTime, nar->selectedEventsPriority[i], false, false, true, false);
+    }
+}
+
+//Selects the most desired active goals for processing
+static void Cycle_PopGoals(NAR *nar)
+{
+    Event *goals[GOAL_SELECTIONS];
+    nar->goalsSelected = PriorityQueue_PopMaxBatch(&nar->goals, GOAL_SELECTIONS, (void**) goals, nar->selectedGoalsPriority);
+    for(int i=0; i<nar->goalsSelected; i++)
+    {
+        nar->selectedGoals[i] = *goals[i];
+    }
+}
+
+//The selected goals stay active, except for the ones the executed decision stems from
+static void Cycle_PushGoals(NAR *nar, Decision *executed)
+{
+    for(int i=0; i<nar->goalsSelected; i++)
+    {
+        if(!executed->execute || !Stamp_checkOverlap(&executed->goalStamp, &nar->selectedGoals[i].stamp))
+        {
+            Memory_addGoal(nar, &nar->selectedGoals[i], nar->selectedGoalsPriority[i], true);
+        }
+    }
+}
+
+//Active goals are satisfied by a positive belief event of the same term
+static void Cycle_SatisfyGoals(NAR *nar, Event *belief)
+{
+    if(Truth_Expectation(belief->truth) <= 0.5)
+    {
+        return;
+    }
+    for(int i=0; i<nar->goals.itemsAmount; i++)
+    {
+        if(Term_Equal(&belief->term, &((Event*) nar->goals.items[i].address)->term))
+        {
+            PriorityQueue_PopAt(&nar->goals, i, NULL);
+            return; //active goals are unique by term
+        }
+    }
+}
+
+#if STAGE==2
+//Inference between the selected event and a concept, returns whether they have a common term
+static bool Cycle_InferWithConcept(NAR *nar, Event *e, TermHashes *hashes_of_e, double priority, Concept *c, long currentTime)
+{
+    long validation_cid = c->id; //allows for lockfree rule table application (only adding to memory is locked)
+    //first filter based on common term (semantic relationship), the subterms up to level 2 are compared by hash, verified in place on a hit
+    bool has_common_term = false;
+    Term *concept_term = Memory_ConceptTerm(nar, c);
+    TermHashes *hashes_of_c = TermStore_SubtermHashes(&nar->terms, c->term);
+    for(int k=1; k<=5; k++)
+    {
+        for(int h=1; h<=5; h++)
+        {
+            if(hashes_of_c->hashes[k] != 0 && hashes_of_c->hashes[k] == hashes_of_e->hashes[h] && Term_SubtermEqual(concept_term, k, &e->term, h))
+            {
+                has_common_term = true;
+                goto PROCEED;
+            }
+        }
+    }
+    PROCEED:;
+    //second  filter based on precondition implication (temporal relationship)
+    bool is_temporally_related = false;
+    for(int k=0; k<c->precondition_beliefs.itemsAmount; k++)
+    {
+        Implication imp = *Table_At(&c->precondition_beliefs, k);
+        Term subject = Term_ExtractSubterm(&imp.term, 1);
+        if(Variable_Unify(&subject, &e->term).success)
+        {
+            is_temporally_related = true;
+            break;
+        }
+    }
+    if(has_common_term && c->belief.type != EVENT_TYPE_DELETED)
+    {
+        //use eternal belief as belief
+        Event* belief = &c->belief;
+        Event future_belief = c->predicted_belief;
+        //but if there is a predicted one in the event's window, use this one
+        if(e->occurrenceTime != OCCURRENCE_ETERNAL && future_belief.type != EVENT_TYPE_DELETED &&
+           labs(e->occurrenceTime - future_belief.occurrenceTime) < EVENT_BELIEF_DISTANCE) //take event as belief if it's stronger
+        {
+            future_belief.truth = Truth_Projection(future_belief.truth, future_belief.occurrenceTime, e->occurrenceTime);
+            future_belief.occurrenceTime = e->occurrenceTime;
+            belief = &future_belief;
+        }
+        //unless there is an actual belief which falls into the event's window
+        Event project_belief = c->belief_spike;
+        if(e->occurrenceTime != OCCURRENCE_ETERNAL && project_belief.type != EVENT_TYPE_DELETED &&
+           labs(e->occurrenceTime - project_belief.occurrenceTime) < EVENT_BELIEF_DISTANCE) //take event as belief if it's stronger
+        {
+            project_belief.truth = Truth_Projection(project_belief.truth, project_belief.occurrenceTime, e->occurrenceTime);
+            project_belief.occurrenceTime = e->occurrenceTime;
+            belief = &project_belief;
+        }
+        //Check for overlap and apply inference rules
+        if(!Stamp_checkOverlap(&e->stamp, &belief->stamp))
+        {
+            Stamp stamp = Stamp_make(&e->stamp, &belief->stamp);
+            if(PRINT_CONTROL_INFO)
+            {
+                fputs("Apply rule table on ", stdout);
+                Narsese_PrintTerm(&e->term);
+                printf(" Priority=%f\n", priority);
+                fputs(" and ", stdout);
+                Narsese_PrintTerm(concept_term);
+                puts("");
+            }
+            RuleTable_Apply(nar, e->term, *concept_term, e->truth, belief->truth, e->occurrenceTime, stamp, currentTime, priority, Numeric_ToReal(nar->concept_priority[Memory_ConceptSlot(nar, c)]), true, c, validation_cid);
+        }
+    }
+    if(is_temporally_related)
+    {
+        for(int i=0; i<c->precondition_beliefs.itemsAmount; i++)
+        {
+            Implication *imp = Table_At(&c->precondition_beliefs, i);
+            assert(Narsese_copulaEquals(imp->term.atoms[0],'$'), "Not a valid implication term!");
+            Term precondition_with_op = Term_ExtractSubterm(&imp->term, 1);
+            Term precondition = Narsese_GetPreconditionWithoutOp(&precondition_with_op);
+            Substitution subs = Variable_Unify(&precondition, &e->term);
+            if(subs.success)
+            {
+                Implication updated_imp = *imp;
+                updated_imp.term = Variable_ApplySubstitute(updated_imp.term, subs);
+                Event predicted = Inference_BeliefDeduction(e, &updated_imp);
+                NAL_DerivedEvent(nar, predicted.term, predicted.occurrenceTime, predicted.truth, predicted.stamp, currentTime, priority, Truth_Expectation(imp->truth), c, validation_cid, TRACE_RULE_PREDICTION);
+            }
+        }
     }
+    return has_common_term;
 }
+#endif
 
-void pushEvents(long currentTime)
+//Add the input events which other threads queued since the last cycle
+static void Cycle_AddQueuedInputs(NAR *nar, long currentTime)
 {
-    for(int i=0; i<eventsSelected; i++)
+    __atomic_store_n(&nar->feedbackPending, 0, __ATOMIC_RELAXED);
+    Event queued;
+    while(EventQueue_Pop(&nar->inputs, &queued))
     {
-        Memory_addEvent(&selectedEvents[i], currentTime, selectedEventsPriority[i], false, false, true, false);
+        Event ev = Event_InputEvent(queued.term, queued.type, queued.truth, currentTime, nar->base++);
+        if(queued.occurrenceTime == OCCURRENCE_ETERNAL)
+        {
+            ev.occurrenceTime = OCCURRENCE_ETERNAL;
+        }
+        Memory_addInputEvent(nar, &ev, currentTime);
     }
 }
 
-void Cycle_Perform(long currentTime)
+void Cycle_Perform(NAR *nar, long currentTime)
 {   
-    eventsSelected = 0;
-    popEvents();
+    //in real-time mode the cycle has a deadline, spike propagation and inference stop when it passed
+    bool realtime = CYCLE_BUDGET_MS > 0;
+    double deadline = realtime ? Cycle_Milliseconds() + CYCLE_BUDGET_MS : 0;
+    bool truncated = false;
+    Cycle_AddQueuedInputs(nar, currentTime);
+    nar->eventsSelected = 0;
+    popEvents(nar);
     //1. process newest event
-    if(belief_events.itemsAmount > 0)
+    bool newBelief = false;
+    if(nar->belief_events.itemsAmount > 0)
     {
         //form concepts for the sequences of different length
         for(int len=0; len<MAX_SEQUENCE_LEN; len++)
         {
-            Event *toProcess = FIFO_GetNewestSequence(&belief_events, len);
+            Event *toProcess = FIFO_GetNewestSequence(&nar->belief_events, len);
             if(toProcess != NULL && !toProcess->processed && toProcess->type != EVENT_TYPE_DELETED)
             {
                 assert(toProcess->type == EVENT_TYPE_BELIEF, "A different event type made it into belief events!");
-                Cycle_ProcessEvent(toProcess, currentTime);
+                Cycle_ProcessEvent(nar, toProcess, currentTime);
                 Event postcondition = *toProcess;
                 //Mine for <(&/,precondition,operation) =/> postcondition> patterns in the FIFO:
                 if(len == 0) //postcondition always len1
                 {
+                    newBelief = true;
+                    Cycle_SatisfyGoals(nar, toProcess);
                     int op_id = Narsese_getOperationID(&postcondition.term);
-                    Decision_AssumptionOfFailure(op_id, currentTime); //collection of negative evidence, new way
+                    Decision_AssumptionOfFailure(nar, op_id, currentTime); //collection of negative evidence, new way
                     //build link between internal derivations and external event to explain it:
-                    for(int k=0; k<eventsSelected; k++)
+                    for(int k=0; k<nar->eventsSelected; k++)
                     {
-                        if(selectedEvents[k].occurrenceTime < postcondition.occurrenceTime)
+                        if(nar->selectedEvents[k].occurrenceTime < postcondition.occurrenceTime)
                         {
-                            Cycle_ReinforceLink(&selectedEvents[k], &postcondition);
+                            Cycle_ReinforceLink(nar, &nar->selectedEvents[k], &postcondition);
                         }
                     }
-                    for(int k=1; k<belief_events.itemsAmount; k++)
+                    for(int k=1; k<nar->belief_events.itemsAmount; k++)
                     {
                         for(int len2=0; len2<MAX_SEQUENCE_LEN; len2++)
                         {
-                            Event *precondition = FIFO_GetKthNewestSequence(&belief_events, k, len2);
+                            Event *precondition = FIFO_GetKthNewestSequence(&nar->belief_events, k, len2);
                             if(precondition != NULL && precondition->type != EVENT_TYPE_DELETED)
                             {
                                 Term precond = Narsese_GetPreconditionWithoutOp(&precondition->term);  //a or (&/,a,op)
@@ -292,7 +512,7 @@ void Cycle_Perform(long currentTime)
                                         goto NoReinforce; //if there is an op in a, then a longer sequ has also, try different k
                                     }
                                 }
-                                Cycle_ReinforceLink(precondition, &postcondition);
+                                Cycle_ReinforceLink(nar, precondition, &postcondition);
                                 NoReinforce:;
                             }
                         }
@@ -301,193 +521,207 @@ void Cycle_Perform(long currentTime)
             }
         }
     }
-    //process goals
-    Decision decision[PROPAGATION_ITERATIONS + 1] = {0};
-    if(goal_events.itemsAmount > 0)
+    //process the most desired goals, their spikes meet in the concepts and are propagated together,
+    //the more desired goal's spike is kept where several goals lead to the same subgoal, so these are processed last.
+    //Goals which were processed already wait for new evidence to be processed again
+    Decision decision[GOAL_SELECTIONS + PROPAGATION_ITERATIONS] = {0};
+    Cycle_PopGoals(nar);
+    int goalsProcessed = 0;
+    for(int i=nar->goalsSelected-1; i>=0; i--)
     {
-        Event *goal = FIFO_GetNewestSequence(&goal_events, 0);
-        if(!goal->processed && goal->type!=EVENT_TYPE_DELETED)
+        if(newBelief || !nar->selectedGoals[i].processed)
         {
-            assert(goal->type == EVENT_TYPE_GOAL, "A different event type made it into goal events!");
-            decision[0] = Cycle_ProcessEvent(goal, currentTime);
-            //allow reasoning into the future by propagating spikes from goals back to potential current events
-            for(int i=0; i<PROPAGATION_ITERATIONS; i++)
+            decision[i] = Cycle_ProcessEvent(nar, &nar->selectedGoals[i], currentTime);
+            goalsProcessed++;
+        }
+    }
+    if(goalsProcessed > 0)
+    {
+        if(BEST_FIRST_PLANNING)
+        {
+            decision[GOAL_SELECTIONS] = Planner_Plan(nar, &nar->selectedGoals[0], currentTime);
+        }
+        else
+        //allow reasoning into the future by propagating spikes from goals back to potential current events
+        for(int i=0; i<PROPAGATION_ITERATIONS; i++)
+        {
+            if(realtime && Cycle_DeadlinePassed(deadline, &truncated))
             {
-                decision[i+1] = Cycle_PropagateSpikes(currentTime);
+                nar->countPropagationIterationsSkipped += PROPAGATION_ITERATIONS - i;
+                break;
             }
+            decision[GOAL_SELECTIONS+i] = Cycle_PropagateSpikes(nar, currentTime);
         }
     }
     //inject the best action if there was one
     Decision best_decision = {0};
-    for(int i=0; i<PROPAGATION_ITERATIONS+1; i++)
+    for(int i=0; i<GOAL_SELECTIONS+PROPAGATION_ITERATIONS; i++)
     {
         if(decision[i].execute && decision[i].desire >= best_decision.desire)
         {
             best_decision = decision[i];
         }
     }
+    Cycle_PushGoals(nar, &best_decision);
     if(best_decision.execute && best_decision.operationID > 0)
     {
-        Decision_Execute(&best_decision);
+        Decision_Execute(nar, &best_decision);
     }
     //end of iterations, remove spikes
-    for(int i=0; i<concepts.itemsAmount; i++)
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
     {
-        Concept *c = concepts.items[i].address;
-        c->incoming_goal_spike = (Event) {0};
-        c->goal_spike = (Event) {0};
+        int slot = nar->concepts.items[i].handle;
+        if(nar->concept_flags[slot] & (CONCEPT_FLAG_INCOMING_GOAL_SPIKE | CONCEPT_FLAG_GOAL_SPIKE))
+        {
+            Concept *c = nar->concepts.items[i].address;
+            c->incoming_goal_spike = (Event) {0};
+            c->goal_spike = (Event) {0};
+            nar->concept_flags[slot] &= ~(CONCEPT_FLAG_INCOMING_GOAL_SPIKE | CONCEPT_FLAG_GOAL_SPIKE);
+        }
     }
     //Inferences
 #if STAGE==2
     long countConceptsMatched = 0;
-    for(int i=0; i<eventsSelected; i++)
+    if(realtime && nar->eventsSelected > 0)
     {
-        Event *e = &selectedEvents[i];
-        Term subterms_of_e[6] = {0}; //subterms up to level 2
-        for(int j=0; j<5; j++)
+        Cycle_OrderConceptsByPriority(nar);
+    }
+    for(int i=0; i<nar->eventsSelected; i++)
+    {
+        if(realtime && (truncated || Cycle_DeadlinePassed(deadline, &truncated)))
         {
-            subterms_of_e[j] = Term_ExtractSubterm(&e->term, j+1);
+            nar->countConceptInferencesSkipped += nar->conceptsByPriorityAmount;
+            continue;
         }
-        double priority = selectedEventsPriority[i];
+        Event *e = &nar->selectedEvents[i];
+        TermHashes hashes_of_e;
+        Term_SubtermHashes(&e->term, &hashes_of_e);
+        double priority = nar->selectedEventsPriority[i];
         Term dummy_term = {0};
         Truth dummy_truth = {0};
-        RuleTable_Apply(e->term, dummy_term, e->truth, dummy_truth, e->occurrenceTime, e->stamp, currentTime, priority, 1, false, NULL, 0); 
+        RuleTable_Apply(nar, e->term, dummy_term, e->truth, dummy_truth, e->occurrenceTime, e->stamp, currentTime, priority, 1, false, NULL, 0); 
         IN_DEBUG( puts("Event was selected:"); Event_Print(e); )
         //Adjust dynamic firing threshold: (proportional "self"-control)
-        double conceptPriorityThresholdCurrent = conceptPriorityThreshold;
-        long countConceptsMatchedAverage = Stats_countConceptsMatchedTotal / currentTime;
+        double conceptPriorityThresholdCurrent = nar->conceptPriorityThreshold;
+        long countConceptsMatchedAverage = nar->countConceptsMatchedTotal / currentTime;
         double set_point = BELIEF_CONCEPT_MATCH_TARGET;
         double process_value = countConceptsMatchedAverage; 
         double error = process_value - set_point;
         double increment = error*CONCEPT_THRESHOLD_ADAPTATION;
-        conceptPriorityThreshold = MIN(1.0, MAX(0.0, conceptPriorityThreshold + increment));
-        //printf("conceptPriorityThreshold=%f\n", conceptPriorityThreshold);
+        nar->conceptPriorityThreshold = MIN(1.0, MAX(0.0, nar->conceptPriorityThreshold + increment));
+        //printf("conceptPriorityThreshold=%f\n", nar->conceptPriorityThreshold);
+        long countConceptsMatchedBefore = countConceptsMatched;
         //Main inference loop:
-        #pragma omp parallel for
-        for(int j=0; j<concepts.itemsAmount; j++)
+        if(CYCLE_BUDGET_MS <= 0)
         {
-            Concept *c = concepts.items[j].address;
-            long validation_cid = c->id; //allows for lockfree rule table application (only adding to memory is locked)
-            if(c->priority < conceptPriorityThresholdCurrent)
+            #pragma omp parallel for reduction(+:countConceptsMatched)
+            for(int j=0; j<nar->concepts.itemsAmount; j++)
             {
-                continue;
-            }
-            //first filter based on common term (semantic relationship)
-            bool has_common_term = false;
-            for(int k=0; k<5; k++)
-            {
-                Term current = Term_ExtractSubterm(&c->term, k+1);
-                for(int h=0; h<5; h++)
+                if(Numeric_ToReal(nar->concept_priority[nar->concepts.items[j].handle]) >= conceptPriorityThresholdCurrent)
                 {
-                    if(current.atoms[0] != 0 && subterms_of_e[h].atoms[0] != 0)
-                    {
-                        if(Term_Equal(&current, &subterms_of_e[h]))
-                        {
-                            has_common_term = true;
-                            goto PROCEED;
-                        }
-                    }
+                    Concept *c = nar->concepts.items[j].address;
+                    countConceptsMatched += Cycle_InferWithConcept(nar, e, &hashes_of_e, priority, c, currentTime);
                 }
             }
-            PROCEED:;
-            //second  filter based on precondition implication (temporal relationship)
-            bool is_temporally_related = false;
-            for(int k=0; k<c->precondition_beliefs[0].itemsAmount; k++)
-            {
-                Implication imp = c->precondition_beliefs[0].array[k];
-                Term subject = Term_ExtractSubterm(&imp.term, 1);
-                if(Variable_Unify(&subject, &e->term).success)
-                {
-                    is_temporally_related = true;
-                    break;
-                }
-            }
-            if(has_common_term)
-            {
-                #pragma omp critical
-                {
-                    countConceptsMatched++;
-                    Stats_countConceptsMatchedTotal++;
-                }
-            }
-            if(has_common_term && c->belief.type != EVENT_TYPE_DELETED)
+        }
+        else
+        {
+            //anytime inference: the concepts are taken in priority order, till the deadline passed
+            long skipped = 0;
+            #pragma omp parallel for schedule(dynamic, CYCLE_DEADLINE_CHECK_INTERVAL) reduction(+:countConceptsMatched,skipped)
+            for(int j=0; j<nar->conceptsByPriorityAmount; j++)
             {
-                //use eternal belief as belief
-                Event* belief = &c->belief;
-                Event future_belief = c->predicted_belief;
-                //but if there is a predicted one in the event's window, use this one
-                if(e->occurrenceTime != OCCURRENCE_ETERNAL && future_belief.type != EVENT_TYPE_DELETED &&
-                   abs(e->occurrenceTime - future_belief.occurrenceTime) < EVENT_BELIEF_DISTANCE) //take event as belief if it's stronger
+                if(__atomic_load_n(&truncated, __ATOMIC_RELAXED) || (j % CYCLE_DEADLINE_CHECK_INTERVAL == 0 && Cycle_DeadlinePassed(deadline, &truncated)))
                 {
-                    future_belief.truth = Truth_Projection(future_belief.truth, future_belief.occurrenceTime, e->occurrenceTime);
-                    future_belief.occurrenceTime = e->occurrenceTime;
-                    belief = &future_belief;
+                    skipped++;
+                    continue;
                 }
-                //unless there is an actual belief which falls into the event's window
-                Event project_belief = c->belief_spike;
-                if(e->occurrenceTime != OCCURRENCE_ETERNAL && project_belief.type != EVENT_TYPE_DELETED &&
-                   abs(e->occurrenceTime - project_belief.occurrenceTime) < EVENT_BELIEF_DISTANCE) //take event as belief if it's stronger
+                Concept *c = nar->conceptsByPriority[j];
+                if(Numeric_ToReal(nar->concept_priority[Memory_ConceptSlot(nar, c)]) >= conceptPriorityThresholdCurrent)
                 {
-                    project_belief.truth = Truth_Projection(project_belief.truth, project_belief.occurrenceTime, e->occurrenceTime);
-                    project_belief.occurrenceTime = e->occurrenceTime;
-                    belief = &project_belief;
-                }
-                //Check for overlap and apply inference rules
-                if(!Stamp_checkOverlap(&e->stamp, &belief->stamp))
-                {
-                    Stamp stamp = Stamp_make(&e->stamp, &belief->stamp);
-                    if(PRINT_CONTROL_INFO)
-                    {
-                        fputs("Apply rule table on ", stdout);
-                        Narsese_PrintTerm(&e->term);
-                        printf(" Priority=%f\n", priority);
-                        fputs(" and ", stdout);
-                        Narsese_PrintTerm(&c->term);
-                        puts("");
-                    }
-                    RuleTable_Apply(e->term, c->term, e->truth, belief->truth, e->occurrenceTime, stamp, currentTime, priority, c->priority, true, c, validation_cid);
-                }
-            }
-            if(is_temporally_related)
-            {
-                for(int i=0; i<c->precondition_beliefs[0].itemsAmount; i++)
-                {
-                    Implication *imp = &c->precondition_beliefs[0].array[i];
-                    assert(Narsese_copulaEquals(imp->term.atoms[0],'$'), "Not a valid implication term!");
-                    Term precondition_with_op = Term_ExtractSubterm(&imp->term, 1);
-                    Term precondition = Narsese_GetPreconditionWithoutOp(&precondition_with_op);
-                    Substitution subs = Variable_Unify(&precondition, &e->term);
-                    if(subs.success)
-                    {
-                        Implication updated_imp = *imp;
-                        updated_imp.term = Variable_ApplySubstitute(updated_imp.term, subs);
-                        Event predicted = Inference_BeliefDeduction(e, &updated_imp);
-                        NAL_DerivedEvent(predicted.term, predicted.occurrenceTime, predicted.truth, predicted.stamp, currentTime, priority, Truth_Expectation(imp->truth), c, validation_cid);
-                    }
+                    countConceptsMatched += Cycle_InferWithConcept(nar, e, &hashes_of_e, priority, c, currentTime);
                 }
             }
+            nar->countConceptInferencesSkipped += skipped;
+            nar->countConceptInferences += nar->conceptsByPriorityAmount - skipped;
         }
-        if(countConceptsMatched > Stats_countConceptsMatchedMax)
+        nar->countConceptsMatchedTotal += countConceptsMatched - countConceptsMatchedBefore;
+        if(countConceptsMatched > nar->countConceptsMatchedMax)
         {
-            Stats_countConceptsMatchedMax = countConceptsMatched;
+            nar->countConceptsMatchedMax = countConceptsMatched;
         }
     }
 #endif
     //Apply event forgetting:
-    for(int i=0; i<cycling_events.itemsAmount; i++)
+    EventBag_Decay(&nar->cycling_events, EVENT_DURABILITY);
+    //Apply goal forgetting, dropping the goals which lost their priority:
+    for(int i=0; i<nar->goals.itemsAmount; i++)
     {
-        cycling_events.items[i].priority *= EVENT_DURABILITY;
+        nar->goals.items[i].priority *= GOAL_DURABILITY;
+    }
+    PriorityQueue_Rebuild(&nar->goals);
+    while(nar->goals.itemsAmount > 0 && Numeric_ToReal(nar->goals.items[0].priority) < GOAL_PRIORITY_MIN)
+    {
+        PriorityQueue_PopMin(&nar->goals, NULL, NULL);
     }
     //Apply concept forgetting:
-    for(int i=0; i<concepts.itemsAmount; i++)
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
     {
-        Concept *c = concepts.items[i].address;
-        c->priority *= CONCEPT_DURABILITY;
-        concepts.items[i].priority = Usage_usefulness(c->usage, currentTime); //how concept memory is sorted by, by concept usefulness
+        int slot = nar->concepts.items[i].handle;
+        nar->concept_priority[slot] *= CONCEPT_DURABILITY;
+        nar->concepts.items[i].priority = Numeric_FromReal(Usage_usefulness(nar->concept_usage[slot], currentTime)); //how concept memory is sorted by, by concept usefulness
     }
     //Re-sort queues
-    PriorityQueue_Rebuild(&concepts);
-    PriorityQueue_Rebuild(&cycling_events);
+    PriorityQueue_Rebuild(&nar->concepts);
     //push selected events back to the queue as well
-    pushEvents(currentTime);
+    pushEvents(nar, currentTime);
+    if(realtime)
+    {
+        nar->countRealtimeCycles++;
+        nar->countCyclesTruncated += truncated;
+        nar->maxDeadlineOverrunMs = MAX(nar->maxDeadlineOverrunMs, Cycle_Milliseconds() - deadline);
+    }
+}
+
+bool Cycle_Idle(NAR *nar)
+{
+    if(nar->cycling_events.itemsAmount > 0 || nar->goals.itemsAmount > 0 || !EventQueue_Empty(&nar->inputs) ||
+       __atomic_load_n(&nar->feedbackPending, __ATOMIC_ACQUIRE) > 0 ||
+       __atomic_load_n(&nar->operationsCompleted, __ATOMIC_ACQUIRE) != nar->operationsDispatched)
+    {
+        return false;
+    }
+    for(int len=0; len<MAX_SEQUENCE_LEN; len++)
+    {
+        Event *toProcess = FIFO_GetNewestSequence(&nar->belief_events, len);
+        if(toProcess != NULL && !toProcess->processed && toProcess->type != EVENT_TYPE_DELETED)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void Cycle_FastForward(NAR *nar, long currentTime, long cycles)
+{
+    if(cycles <= 0)
+    {
+        return;
+    }
+    //without events and goals only the concepts are forgotten, their priority decays geometrically,
+    //and the usefulness they are sorted by depends on the time of the last cycle only
+    double decay = pow(CONCEPT_DURABILITY, cycles);
+    long lastTime = currentTime + cycles - 1;
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
+    {
+        int slot = nar->concepts.items[i].handle;
+        nar->concept_priority[slot] = Numeric_FromReal(Numeric_ToReal(nar->concept_priority[slot]) * decay);
+        nar->concepts.items[i].priority = Numeric_FromReal(Usage_usefulness(nar->concept_usage[slot], lastTime));
+    }
+    PriorityQueue_Rebuild(&nar->concepts);
+    nar->countCyclesSkipped += cycles;
+    if(CYCLE_BUDGET_MS > 0)
+    {
+        nar->countRealtimeCycles += cycles; //met their deadline
+    }
 }
@@ -39,10 +39,22 @@
 #include "RuleTable.h"
 #include "Variable.h"
 #include "Stats.h"
+#include <time.h>
+
+//Parameters//
+//----------//
+//Wall-clock budget of a cycle in milliseconds, 0 disables the real-time mode
+extern double CYCLE_BUDGET_MS;
+//Whether idle cycles are skipped at once
+extern bool CYCLE_FAST_FORWARD;
 
 //Methods//
 //-------//
 //Apply one operating cyle
-void Cycle_Perform(long currentTime);
+void Cycle_Perform(NAR *nar, long currentTime);
+//Whether a cycle would have nothing to process but forgetting
+bool Cycle_Idle(NAR *nar);
+//Apply the forgetting of the idle cycles from currentTime on at once
+void Cycle_FastForward(NAR *nar, long currentTime, long cycles);
 
 #endif
@@ -28,39 +28,87 @@ double DECISION_THRESHOLD = DECISION_THRESHOLD_INITIAL;
 double ANTICIPATION_THRESHOLD = ANTICIPATION_THRESHOLD_INITIAL;
 double ANTICIPATION_CONFIDENCE = ANTICIPATION_CONFIDENCE_INITIAL;
 double MOTOR_BABBLING_CHANCE = MOTOR_BABBLING_CHANCE_INITIAL;
-//Inject action event after execution or babbling
-void Decision_Execute(Decision *decision)
+//Operator feedback is added at the start of the next cycle, as the current one is still in progress
+static void Decision_AddFeedback(NAR *nar, Term feedback)
+{
+    if(NAR_QueueInput(nar, feedback, EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false))
+    {
+        __atomic_add_fetch(&nar->feedbackPending, 1, __ATOMIC_RELEASE);
+    }
+    else
+    {
+        Event ev = Event_InputEvent(feedback, EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, nar->currentTime, nar->base++);
+        Memory_addInputEvent(nar, &ev, nar->currentTime);
+    }
+}
+
+//Dispatch the action after execution or babbling, its feedback event is injected in the next cycle
+void Decision_Execute(NAR *nar, Decision *decision)
 {
     assert(decision->operationID > 0, "Operation 0 is reserved for no action");
-    decision->op = operations[decision->operationID-1];
-    (*decision->op.action)(decision->arguments);
-    //and add operator feedback
+    Operation *op = Memory_GetOperation(nar, decision->operationID);
+    assert(op != NULL, "The executed operation is not registered");
+    decision->op = *op;
+    Term feedback = decision->op.term; //atomic operation / operator
     if(decision->arguments.atoms[0] > 0) //operation with args
     {
-        Term operation = {0};
-        operation.atoms[0] = Narsese_AtomicTermIndex(":"); //<args --> ^op>
-        Term_OverrideSubterm(&operation, 1, &decision->arguments);
-        Term_OverrideSubterm(&operation, 2, &decision->op.term);
-        NAR_AddInputBelief(operation);
+        feedback = (Term) {0};
+        feedback.atoms[0] = Narsese_AtomicTermIndex(":"); //<args --> ^op>
+        Term_OverrideSubterm(&feedback, 1, &decision->arguments);
+        Term_OverrideSubterm(&feedback, 2, &decision->op.term);
+    }
+    Event execution = { .term = feedback, .type = EVENT_TYPE_BELIEF, .truth = NAR_DEFAULT_TRUTH, .occurrenceTime = nar->currentTime };
+    if(nar->executorActive)
+    {
+        //the executor invokes the action and queues the feedback once it completed
+        if(Executor_Dispatch(nar, &execution))
+        {
+            nar->operationsDispatched++;
+        }
+        else
+        {
+            nar->executionsDropped++;
+        }
+        return;
+    }
+    if(nar->runnerActive)
+    {
+        //the application executes it, the runner thread doesn't wait for the actuator
+        if(!EventQueue_Push(&nar->executions, &execution))
+        {
+            nar->executionsDropped++;
+        }
     }
-    else //atomic operation / operator
+    else
     {
-        NAR_AddInputBelief(decision->op.term);
+        nar->executedOperationID = decision->operationID;
+        (*decision->op.action)(nar, decision->arguments);
     }
+    //and add operator feedback
+    Decision_AddFeedback(nar, feedback);
 }
 
 //"reflexes" to try different operations, especially important in the beginning
-static Decision Decision_MotorBabbling()
+static Decision Decision_MotorBabbling(NAR *nar)
 {
     Decision decision = (Decision) {0};
     int n_ops = 0;
-    for(int i=0; i<OPERATIONS_MAX && operations[i].action != 0; i++)
+    for(int i=0; i<nar->operationsAmount; i++)
     {
-        n_ops = i+1;
+        n_ops += nar->operations[i].action != 0;
     }
     if(n_ops > 0)
     {
-        decision.operationID = 1+(rand() % (n_ops));
+        //the k-th of the registered operations
+        int k = Random_Next(&nar->random) % n_ops;
+        for(int i=0; i<nar->operationsAmount; i++)
+        {
+            if(nar->operations[i].action != 0 && k-- == 0)
+            {
+                decision.operationID = i+1;
+                break;
+            }
+        }
         IN_DEBUG (
             printf(" NAR BABBLE %d\n", decision.operationID);
         )
@@ -69,90 +117,128 @@ static Decision Decision_MotorBabbling()
     return decision;
 }
 
-static Decision Decision_ConsiderImplication(long currentTime, Event *goal, int considered_opi, Implication *imp, Implication *DebugBestImp)
+//Candidate implications of the best candidate search, their desires computed in batches
+typedef struct
+{
+    Implication imps[TRUTH_BATCH_SIZE];
+    int operationIDs[TRUTH_BATCH_SIZE];
+    Truth impTruths[TRUTH_BATCH_SIZE];
+    Truth goalTruths[TRUTH_BATCH_SIZE];
+    long contextTimes[TRUTH_BATCH_SIZE]; //occurrence time of the contextual operation (&/,a,op())! :\:
+    Truth preconditionTruths[TRUTH_BATCH_SIZE];
+    long preconditionTimes[TRUTH_BATCH_SIZE];
+    int amount;
+}Decision_Candidates;
+
+static Decision Decision_ConsiderImplication(int considered_opi, Implication *imp, double desire)
 {
     Decision decision = (Decision) {0};
-    IN_DEBUG
-    (
-        printf("CONSIDERED IMPLICATION: impTruth=(%f, %f)", imp->truth.frequency, imp->truth.confidence);
-        Narsese_PrintTerm(&imp->term);
-        puts("");
-    )
-    //now look at how much the precondition is fulfilled
-    Concept *prec = imp->sourceConcept;
-    Event *precondition = &prec->belief_spike; //a. :|:
-    if(precondition != NULL)
-    {
-        Event ContextualOperation = Inference_GoalDeduction(goal, imp); //(&/,a,op())! :\:
-        double operationGoalTruthExpectation = Truth_Expectation(Inference_OperationDeduction(&ContextualOperation, precondition, currentTime).truth); //op()! :|:
+    //<(precon &/ <args --> ^op>) =/> postcon>. -> [$ , postcon precon : _ _ _ _ args ^op
+    Term operation = Term_ExtractSubterm(&imp->term, 4); //^op or [: args ^op]
+    if(!Narsese_isOperator(operation.atoms[0])) //it is an operation with args, not just an atomic operator, so remember the args
+    {
+        assert(Narsese_isOperator(operation.atoms[2]), "If it's not atomic, it needs to be an operation with args here");
+        decision.arguments = Term_ExtractSubterm(&imp->term, 9); 
+    }
+    decision.operationID = considered_opi;
+    decision.desire = desire;
+    decision.imp = *imp;
+    return decision;
+}
+
+//Desires of the candidates as by goal deduction followed by operation deduction with the precondition, the first most desired one becomes the decision
+static void Decision_ConsiderCandidates(NAR *nar, Event *goal, long currentTime, Decision_Candidates *candidates, Decision *decision)
+{
+    int n = candidates->amount;
+    if(n == 0)
+    {
+        return;
+    }
+    Truth contextualOperation[TRUTH_BATCH_SIZE], contextualOperationUpdated[TRUTH_BATCH_SIZE], preconditionUpdated[TRUTH_BATCH_SIZE], operationGoal[TRUTH_BATCH_SIZE];
+    double operationGoalTruthExpectation[TRUTH_BATCH_SIZE];
+    Truth_DeductionBatch(candidates->impTruths, candidates->goalTruths, contextualOperation, n); //(&/,a,op())! :\:
+    Truth_ProjectionBatch(contextualOperation, candidates->contextTimes, currentTime, contextualOperationUpdated, n);
+    Truth_ProjectionBatch(candidates->preconditionTruths, candidates->preconditionTimes, currentTime, preconditionUpdated, n); //a. :|:
+    Truth_DeductionBatch(contextualOperationUpdated, preconditionUpdated, operationGoal, n); //op()! :|:
+    Truth_ExpectationBatch(operationGoal, operationGoalTruthExpectation, n);
+    for(int i=0; i<n; i++)
+    {
         IN_DEBUG
         (
-            printf("CONSIDERED PRECON: desire=%f ", operationGoalTruthExpectation);
-            Narsese_PrintTerm(&prec->term);
+            printf("CONSIDERED IMPLICATION: desire=%f impTruth=(%f, %f)", operationGoalTruthExpectation[i], Truth_Frequency(candidates->impTruths[i]), Truth_Confidence(candidates->impTruths[i]));
+            Narsese_PrintTerm(&candidates->imps[i].term);
             fputs("\nCONSIDERED PRECON truth ", stdout);
-            Truth_Print(&precondition->truth);
+            Truth_Print(&candidates->preconditionTruths[i]);
             fputs("CONSIDERED goal truth ", stdout);
             Truth_Print(&goal->truth);
-            fputs("CONSIDERED imp truth ", stdout);
-            Truth_Print(&imp->truth);
-            printf("CONSIDERED time %ld\n", precondition->occurrenceTime);
-            Narsese_PrintTerm(&precondition->term); puts("");
+            printf("CONSIDERED time %ld\n", candidates->preconditionTimes[i]);
+            Narsese_PrintTerm(Memory_ConceptTerm(nar, (Concept*) candidates->imps[i].sourceConcept)); puts("");
         )
-        *DebugBestImp = *imp;
-        //<(precon &/ <args --> ^op>) =/> postcon>. -> [$ , postcon precon : _ _ _ _ args ^op
-        Term operation = Term_ExtractSubterm(&imp->term, 4); //^op or [: args ^op]
-        if(!Narsese_isOperator(operation.atoms[0])) //it is an operation with args, not just an atomic operator, so remember the args
+        if(operationGoalTruthExpectation[i] > decision->desire)
         {
-            assert(Narsese_isOperator(operation.atoms[2]), "If it's not atomic, it needs to be an operation with args here");
-            decision.arguments = Term_ExtractSubterm(&imp->term, 9); 
+            *decision = Decision_ConsiderImplication(candidates->operationIDs[i], &candidates->imps[i], operationGoalTruthExpectation[i]);
         }
-        decision.operationID = considered_opi;
-        decision.desire = operationGoalTruthExpectation;
     }
-    return decision;
+    candidates->amount = 0;
 }
 
-int stampID = -1;
-Decision Decision_BestCandidate(Event *goal, long currentTime)
+Decision Decision_BestCandidate(NAR *nar, Event *goal, long currentTime)
 {
     Decision decision = (Decision) {0};
-    Implication bestImp = {0};
-    for(int concept_i=0; concept_i<concepts.itemsAmount; concept_i++)
+    Decision_Candidates candidates;
+    candidates.amount = 0;
+    TERM_HASH_TYPE goalHash = Term_Hash(&goal->term);
+    for(int concept_i=0; concept_i<nar->concepts.itemsAmount; concept_i++)
     {
-        Concept *postc_general = concepts.items[concept_i].address;
-        Substitution subs = Variable_Unify(&postc_general->term, &goal->term);
+        int slot = nar->concepts.items[concept_i].handle;
+        if(!(nar->concept_flags[slot] & CONCEPT_FLAG_VARIABLES) && nar->concept_term_hash[slot] != goalHash)
+        {
+            continue; //without variables the concept term can only match an equal term
+        }
+        Concept *postc_general = nar->concepts.items[concept_i].address;
+        Substitution subs = Variable_Unify(Memory_ConceptTerm(nar, postc_general), &goal->term);
         if(subs.success)
         {
-            for(int opi=1; opi<OPERATIONS_MAX && operations[opi-1].action != 0; opi++)
+            //only the operations the concept has implications with are considered
+            int opi;
+            for(Table *table = Memory_NextPreconditionBeliefs(nar, postc_general, &postc_general->precondition_beliefs, &opi); table != NULL; table = Memory_NextPreconditionBeliefs(nar, postc_general, table, &opi))
             {
-                for(int j=0; j<postc_general->precondition_beliefs[opi].itemsAmount; j++)
+                if(Memory_GetOperation(nar, opi) == NULL)
                 {
-                    if(!Memory_ImplicationValid(&postc_general->precondition_beliefs[opi].array[j]))
-                    {
-                        Table_Remove(&postc_general->precondition_beliefs[opi], j--);
-                        continue;
-                    }
-                    Implication imp = postc_general->precondition_beliefs[opi].array[j];
+                    continue;
+                }
+                for(int j=0; j<table->itemsAmount; j++)
+                {
+                    Implication imp = *Table_At(table, j);
+                    IN_DEBUG( assert(Memory_ImplicationValid(&imp), "Implications of recycled concepts should have been removed"); )
                     imp.term = Variable_ApplySubstitute(imp.term, subs);
                     assert(Narsese_copulaEquals(imp.term.atoms[0], '$'), "This should be an implication!");
                     Term left_side_with_op = Term_ExtractSubterm(&imp.term, 1);
                     Term left_side = Narsese_GetPreconditionWithoutOp(&left_side_with_op); //might be something like <#1 --> a>
-                    for(int cmatch_k=0; cmatch_k<concepts.itemsAmount; cmatch_k++)
+                    for(int cmatch_k=0; cmatch_k<nar->concepts.itemsAmount; cmatch_k++)
                     {
-                        Concept *cmatch = concepts.items[cmatch_k].address;
-                        if(!Variable_hasVariable(&cmatch->term, true, true, true))
+                        if(!(nar->concept_flags[nar->concepts.items[cmatch_k].handle] & CONCEPT_FLAG_VARIABLES))
                         {
-                            Substitution subs2 = Variable_Unify(&left_side, &cmatch->term);
+                            Concept *cmatch = nar->concepts.items[cmatch_k].address;
+                            Substitution subs2 = Variable_Unify(&left_side, Memory_ConceptTerm(nar, cmatch));
                             if(subs2.success)
                             {
                                 Implication specific_imp = imp; //can only be completely specific
                                 specific_imp.term = Variable_ApplySubstitute(specific_imp.term, subs2);
                                 specific_imp.sourceConcept = cmatch;
                                 specific_imp.sourceConceptId = cmatch->id;
-                                Decision considered = Decision_ConsiderImplication(currentTime, goal, opi, &specific_imp, &bestImp);
-                                if(considered.desire > decision.desire)
+                                Event *precondition = &cmatch->belief_spike;
+                                int k = candidates.amount++;
+                                candidates.imps[k] = specific_imp;
+                                candidates.operationIDs[k] = opi;
+                                candidates.impTruths[k] = specific_imp.truth;
+                                candidates.goalTruths[k] = goal->truth;
+                                candidates.contextTimes[k] = goal->occurrenceTime - specific_imp.occurrenceTimeOffset;
+                                candidates.preconditionTruths[k] = precondition->truth;
+                                candidates.preconditionTimes[k] = precondition->occurrenceTime;
+                                if(candidates.amount == TRUTH_BATCH_SIZE)
                                 {
-                                    decision = considered;
+                                    Decision_ConsiderCandidates(nar, goal, currentTime, &candidates, &decision);
                                 }
                             }
                         }
@@ -161,31 +247,30 @@ Decision Decision_BestCandidate(Event *goal, long currentTime)
             }
         }
     }
+    Decision_ConsiderCandidates(nar, goal, currentTime, &candidates, &decision);
     if(decision.desire < DECISION_THRESHOLD)
     {
         return decision;
     }
-    printf("decision expectation %f impTruth=(%f, %f): future=%ld ", decision.desire, bestImp.truth.frequency, bestImp.truth.confidence, bestImp.occurrenceTimeOffset);
-    Narsese_PrintTerm(&bestImp.term); puts("");
+    Output_Printf("decision expectation %f impTruth=(%f, %f): future=%ld ", decision.desire, Truth_Frequency(decision.imp.truth), Truth_Confidence(decision.imp.truth), decision.imp.occurrenceTimeOffset);
+    Narsese_PrintTerm(&decision.imp.term); Output_Puts("\n");
+    Trace_Decision(decision.operationID, decision.desire, &decision.imp, currentTime);
     decision.execute = true;
+    decision.goalStamp = goal->stamp;
     return decision;
 }
 
-void Decision_AssumptionOfFailure(int operationID, long currentTime)
+void Decision_AssumptionOfFailure(NAR *nar, int operationID, long currentTime)
 {
-    assert(operationID >= 0 && operationID < OPERATIONS_MAX, "Wrong operation id, did you inject an event manually?");
-    for(int j=0; j<concepts.itemsAmount; j++)
+    assert(operationID >= 0 && operationID <= OPERATIONS_MAX, "Wrong operation id, did you inject an event manually?");
+    for(int j=0; j<nar->concepts.itemsAmount; j++)
     {
-        Concept *postc = concepts.items[j].address;
-        for(int  h=0; h<postc->precondition_beliefs[operationID].itemsAmount; h++)
+        Concept *postc = nar->concepts.items[j].address;
+        Table *table = Memory_PreconditionBeliefs(nar, postc, operationID, false);
+        for(int  h=0; table != NULL && h<table->itemsAmount; h++)
         {
-            if(!Memory_ImplicationValid(&postc->precondition_beliefs[operationID].array[h]))
-            {
-                Table_Remove(&postc->precondition_beliefs[operationID], h);
-                h--;
-                continue;
-            }
-            Implication imp = postc->precondition_beliefs[operationID].array[h]; //(&/,a,op) =/> b.
+            Implication imp = *Table_At(table, h); //(&/,a,op) =/> b.
+            IN_DEBUG( assert(Memory_ImplicationValid(&imp), "Implications of recycled concepts should have been removed"); )
             Concept *current_prec = imp.sourceConcept;
             Event *precondition = &current_prec->belief_spike; //a. :|:
             if(precondition != NULL && precondition->type != EVENT_TYPE_DELETED)
@@ -193,41 +278,37 @@ void Decision_AssumptionOfFailure(int operationID, long currentTime)
                 assert(precondition->occurrenceTime != OCCURRENCE_ETERNAL, "Precondition should not be eternal!");
                 Event updated_precondition = Inference_EventUpdate(precondition, currentTime);
                 Event op = { .type = EVENT_TYPE_BELIEF,
-                             .truth = (Truth) { .frequency = 1.0, .confidence = 0.9 },
+                             .truth = Truth_New(1.0, 0.9),
                              .occurrenceTime = currentTime };
                 Event seqop = Inference_BeliefIntersection(&updated_precondition, &op); //(&/,a,op). :|:
                 Event result = Inference_BeliefDeduction(&seqop, &imp); //b. :/:
                 if(Truth_Expectation(result.truth) > ANTICIPATION_THRESHOLD)
                 {
                     Implication negative_confirmation = imp;
-                    Truth TNew = { .frequency = 0.0, .confidence = ANTICIPATION_CONFIDENCE };
+                    Truth TNew = Truth_New(0.0, ANTICIPATION_CONFIDENCE);
                     Truth TPast = Truth_Projection(precondition->truth, 0, imp.occurrenceTimeOffset);
                     negative_confirmation.truth = Truth_Eternalize(Truth_Induction(TPast, TNew));
-                    negative_confirmation.stamp = (Stamp) { .evidentalBase = { -stampID } };
-                    assert(negative_confirmation.truth.confidence >= 0.0 && negative_confirmation.truth.confidence <= 1.0, "(666) confidence out of bounds");
-                    Implication *added = Table_AddAndRevise(&postc->precondition_beliefs[operationID], &negative_confirmation);
-                    if(added != NULL)
-                    {
-                        added->sourceConcept = negative_confirmation.sourceConcept;
-                        added->sourceConceptId = negative_confirmation.sourceConceptId;
-                    }                                
-                    stampID--;
+                    negative_confirmation.stamp = Stamp_new(-nar->stampID);
+                    assert(Truth_Confidence(negative_confirmation.truth) >= 0.0 && Truth_Confidence(negative_confirmation.truth) <= 1.0, "(666) confidence out of bounds");
+                    Table_AddAndRevise(nar, table, &negative_confirmation);
+                    nar->stampID--;
                 }
             }
         }
     }
 }
 
-Decision Decision_Suggest(Event *goal, long currentTime)
+Decision Decision_Suggest(NAR *nar, Event *goal, long currentTime)
 {
     Decision babble_decision = {0};
     //try motor babbling with a certain chance
-    if(rand() % 1000000 < (int)(MOTOR_BABBLING_CHANCE*1000000.0))
+    if(Random_Next(&nar->random) % 1000000 < (int)(MOTOR_BABBLING_CHANCE*1000000.0))
     {
-        babble_decision = Decision_MotorBabbling();
+        babble_decision = Decision_MotorBabbling(nar);
+        babble_decision.goalStamp = goal->stamp;
     }
     //try matching op if didn't motor babble
-    Decision decision_suggested = Decision_BestCandidate(goal, currentTime);
+    Decision decision_suggested = Decision_BestCandidate(nar, goal, currentTime);
     if(!babble_decision.execute || decision_suggested.desire > MOTOR_BABBLING_SUPPRESSION_THRESHOLD)
     {
        return decision_suggested;
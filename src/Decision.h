@@ -31,6 +31,7 @@
 #include <stdio.h>
 #include "Memory.h"
 #include "NAR.h"
+#include "Executor.h"
 #include "Config.h"
 
 ////////////////////
@@ -54,15 +55,17 @@ typedef struct
     int operationID;
     Operation op;
     Term arguments;
+    Stamp goalStamp; //evidence of the (sub)goal the decision realizes
+    Implication imp; //the implication the decision came from
 }Decision;
 
 //Methods//
 //-------//
 //execute decision
-void Decision_Execute(Decision *decision);
+void Decision_Execute(NAR *nar, Decision *decision);
 //assumption of failure, also works for "do nothing operator"
-void Decision_AssumptionOfFailure(int operationID, long currentTime);
+void Decision_AssumptionOfFailure(NAR *nar, int operationID, long currentTime);
 //NAR decision making rule applying when goal is an operation
-Decision Decision_Suggest(Event *goal, long currentTime);
+Decision Decision_Suggest(NAR *nar, Event *goal, long currentTime);
 
 #endif
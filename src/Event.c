@@ -31,23 +31,17 @@ void Event_SetTerm(Event *event, Term term)
     //event->term_hash = Term_Hash(&term);
 }
 
-long base = 1;
-Event Event_InputEvent(Term term, char type, Truth truth, long currentTime)
+Event Event_InputEvent(Term term, char type, Truth truth, long currentTime, long stampID)
 {
     return (Event) { .term = term,
                      /*.term_hash = Term_Hash(&term),*/
                      .type = type, 
                      .truth = truth, 
-                     .stamp = (Stamp) { .evidentalBase = { base++ } }, 
+                     .stamp = Stamp_new(stampID), 
                      .occurrenceTime = currentTime,
                      .creationTime = currentTime };
 }
 
-void Event_INIT()
-{
-    base = 1;
-}
-
 void Event_Print(Event *event)
 {
     printf("Event: \n");
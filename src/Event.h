@@ -53,12 +53,10 @@ typedef struct {
 
 //Methods//
 //-------//
-//Init/Reset module
-void Event_INIT();
 //Assign a new name to an event
 void Event_SetTerm(Event *event, Term term);
-//construct an input event
-Event Event_InputEvent(Term term, char type, Truth truth, long currentTime);
+//construct an input event with the given evidental base ID
+Event Event_InputEvent(Term term, char type, Truth truth, long currentTime, long stampID);
 //print event
 void Event_Print(Event *event);
 //Whether two events are the same
@@ -0,0 +1,199 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "EventBag.h"
+
+static int EventBag_Level(double priority)
+{
+    return MIN(EVENT_BAG_LEVELS-1, MAX(0, (int) (priority * (EVENT_BAG_LEVELS-1))));
+}
+
+static int EventBag_Bucket(EventBag *bag, Event *event)
+{
+    return (int) ((unsigned long) Term_Hash(&event->term) % (unsigned long) bag->bucketsAmount);
+}
+
+void EventBag_RESET(EventBag *bag, EventBag_Item *items, int maxElements, int *buckets, int bucketsAmount)
+{
+    bag->items = items;
+    bag->maxElements = maxElements;
+    bag->buckets = buckets;
+    bag->bucketsAmount = bucketsAmount;
+    for(int i=0; i<maxElements; i++)
+    {
+        items[i] = (EventBag_Item) { .level = -1, .prev = -1, .next = i+1 < maxElements ? i+1 : -1, .hashNext = -1 };
+    }
+    for(int i=0; i<bucketsAmount; i++)
+    {
+        buckets[i] = -1;
+    }
+    for(int i=0; i<EVENT_BAG_LEVELS; i++)
+    {
+        bag->first[i] = bag->last[i] = -1;
+    }
+    bag->highestLevel = 0;
+    bag->lowestLevel = EVENT_BAG_LEVELS-1;
+    bag->free = maxElements > 0 ? 0 : -1;
+    bag->itemsAmount = 0;
+}
+
+//Appends the item to its level
+static void EventBag_Link(EventBag *bag, int i)
+{
+    EventBag_Item *item = &bag->items[i];
+    item->prev = bag->last[item->level];
+    item->next = -1;
+    if(item->prev == -1)
+    {
+        bag->first[item->level] = i;
+    }
+    else
+    {
+        bag->items[item->prev].next = i;
+    }
+    bag->last[item->level] = i;
+    bag->highestLevel = MAX(bag->highestLevel, item->level);
+    bag->lowestLevel = MIN(bag->lowestLevel, item->level);
+}
+
+static void EventBag_Unlink(EventBag *bag, int i)
+{
+    EventBag_Item *item = &bag->items[i];
+    if(item->prev == -1)
+    {
+        bag->first[item->level] = item->next;
+    }
+    else
+    {
+        bag->items[item->prev].next = item->next;
+    }
+    if(item->next == -1)
+    {
+        bag->last[item->level] = item->prev;
+    }
+    else
+    {
+        bag->items[item->next].prev = item->prev;
+    }
+}
+
+static void EventBag_Remove(EventBag *bag, int i)
+{
+    EventBag_Unlink(bag, i);
+    int *link = &bag->buckets[EventBag_Bucket(bag, &bag->items[i].event)];
+    while(*link != i)
+    {
+        link = &bag->items[*link].hashNext;
+    }
+    *link = bag->items[i].hashNext;
+    bag->items[i].level = -1;
+    bag->items[i].next = bag->free;
+    bag->free = i;
+    bag->itemsAmount--;
+}
+
+bool EventBag_Contains(EventBag *bag, Event *event)
+{
+    for(int i=bag->buckets[EventBag_Bucket(bag, event)]; i != -1; i = bag->items[i].hashNext)
+    {
+        if(Event_Equal(event, &bag->items[i].event))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool EventBag_Add(EventBag *bag, Event *event, double priority)
+{
+    if(bag->itemsAmount >= bag->maxElements)
+    {
+        while(bag->first[bag->lowestLevel] == -1)
+        {
+            bag->lowestLevel++;
+        }
+        int evicted = bag->first[bag->lowestLevel];
+        if(Numeric_FromReal(priority) < bag->items[evicted].priority)
+        {
+            return false;
+        }
+        EventBag_Remove(bag, evicted);
+    }
+    int i = bag->free;
+    EventBag_Item *item = &bag->items[i];
+    bag->free = item->next;
+    item->event = *event;
+    item->priority = Numeric_FromReal(priority);
+    item->level = EventBag_Level(priority);
+    EventBag_Link(bag, i);
+    int bucket = EventBag_Bucket(bag, event);
+    item->hashNext = bag->buckets[bucket];
+    bag->buckets[bucket] = i;
+    bag->itemsAmount++;
+    return true;
+}
+
+bool EventBag_PopMax(EventBag *bag, Event *event, double *priority)
+{
+    if(bag->itemsAmount == 0)
+    {
+        return false;
+    }
+    while(bag->first[bag->highestLevel] == -1)
+    {
+        bag->highestLevel--;
+    }
+    int i = bag->last[bag->highestLevel];
+    *event = bag->items[i].event;
+    *priority = Numeric_ToReal(bag->items[i].priority);
+    EventBag_Remove(bag, i);
+    return true;
+}
+
+void EventBag_Decay(EventBag *bag, double durability)
+{
+    if(durability == 1.0 || bag->itemsAmount == 0)
+    {
+        return;
+    }
+    //the priorities only decrease, so the items moved to a lower level were visited already
+    int highestLevel = bag->highestLevel;
+    for(int level=bag->lowestLevel; level<=highestLevel; level++)
+    {
+        for(int i=bag->first[level]; i != -1;)
+        {
+            EventBag_Item *item = &bag->items[i];
+            int next = item->next;
+            item->priority *= durability;
+            int newLevel = EventBag_Level(Numeric_ToReal(item->priority));
+            if(newLevel != level)
+            {
+                EventBag_Unlink(bag, i);
+                item->level = newLevel;
+                EventBag_Link(bag, i);
+            }
+            i = next;
+        }
+    }
+}
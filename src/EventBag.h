@@ -0,0 +1,81 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_EVENTBAG
+#define H_EVENTBAG
+
+///////////////////
+//  Event bag    //
+///////////////////
+//The events cycling in main memory, in a bag of priority levels as in OpenNARS:
+//an event is put into the level of its priority and taken from the highest non-empty level,
+//the lowest one is evicted from when the bag is full, a hash set of the events avoids duplicates.
+//Within a level the most recently added event is taken first and the oldest one is evicted first.
+
+//References//
+//-----------//
+#include <stdbool.h>
+#include "Globals.h"
+#include "Event.h"
+#include "Config.h"
+
+//Data structure//
+//--------------//
+typedef struct
+{
+    Event event;
+    Numeric priority;
+    int level; //-1 if the item is free
+    int prev; //neighbours within the level, -1 at its ends
+    int next;
+    int hashNext; //next item of the hash bucket, -1 at its end
+} EventBag_Item;
+typedef struct
+{
+    EventBag_Item *items;
+    int maxElements;
+    int *buckets; //first item of each hash bucket
+    int bucketsAmount;
+    int first[EVENT_BAG_LEVELS]; //first item of each level, -1 if empty
+    int last[EVENT_BAG_LEVELS];
+    int highestLevel; //no level above is occupied
+    int lowestLevel; //no level below is occupied
+    int free; //first free item, chained via next
+    int itemsAmount;
+} EventBag;
+
+//Methods//
+//-------//
+//Resets the bag to use the given item and hash bucket storage
+void EventBag_RESET(EventBag *bag, EventBag_Item *items, int maxElements, int *buckets, int bucketsAmount);
+//Whether the bag contains an equal event
+bool EventBag_Contains(EventBag *bag, Event *event);
+//Adds the event with the priority, evicting one of the lowest level when full, returns false if the priority is too low to enter
+bool EventBag_Add(EventBag *bag, Event *event, double priority);
+//Takes the newest event of the highest level, returns false if the bag is empty
+bool EventBag_PopMax(EventBag *bag, Event *event, double *priority);
+//Multiplies the priorities with the durability, moving the events to their new levels
+void EventBag_Decay(EventBag *bag, double durability);
+
+#endif
@@ -0,0 +1,80 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "EventQueue.h"
+
+//Slot positions are counted from zero and only grow, a slot of position pos is free for pos if its sequence equals pos,
+//and readable if it equals pos+1, the sequence is stored relative to the slot index
+#define EVENT_QUEUE_MASK (EVENT_QUEUE_SIZE-1)
+
+bool EventQueue_Push(EventQueue *queue, Event *event)
+{
+    size_t pos = __atomic_load_n(&queue->enqueuePosition, __ATOMIC_RELAXED);
+    for(;;)
+    {
+        EventQueue_Slot *slot = &queue->slots[pos & EVENT_QUEUE_MASK];
+        size_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) + (pos & EVENT_QUEUE_MASK);
+        if(sequence == pos)
+        {
+            if(__atomic_compare_exchange_n(&queue->enqueuePosition, &pos, pos + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+            {
+                slot->event = *event;
+                __atomic_store_n(&slot->sequence, pos + 1 - (pos & EVENT_QUEUE_MASK), __ATOMIC_RELEASE);
+                return true;
+            }
+            //pos was updated by the failed compare-and-swap
+        }
+        else
+        if((ptrdiff_t) (sequence - pos) < 0)
+        {
+            return false; //the slot still holds an event of the previous round
+        }
+        else
+        {
+            pos = __atomic_load_n(&queue->enqueuePosition, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+bool EventQueue_Pop(EventQueue *queue, Event *event)
+{
+    size_t pos = queue->dequeuePosition;
+    EventQueue_Slot *slot = &queue->slots[pos & EVENT_QUEUE_MASK];
+    size_t sequence = __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) + (pos & EVENT_QUEUE_MASK);
+    if(sequence != pos + 1)
+    {
+        return false;
+    }
+    *event = slot->event;
+    __atomic_store_n(&slot->sequence, pos + EVENT_QUEUE_SIZE - (pos & EVENT_QUEUE_MASK), __ATOMIC_RELEASE);
+    queue->dequeuePosition = pos + 1;
+    return true;
+}
+
+bool EventQueue_Empty(EventQueue *queue)
+{
+    size_t pos = queue->dequeuePosition;
+    EventQueue_Slot *slot = &queue->slots[pos & EVENT_QUEUE_MASK];
+    return __atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) + (pos & EVENT_QUEUE_MASK) != pos + 1;
+}
@@ -0,0 +1,64 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_EVENTQUEUE
+#define H_EVENTQUEUE
+
+////////////////////
+//  Event queue   //
+////////////////////
+//A bounded lock-free multi-producer single-consumer queue of events.
+//Each slot carries a sequence number which tells whether it's ready to be written or read,
+//producers claim slots with a compare-and-swap, so they never wait for each other or the consumer.
+
+//References//
+//-----------//
+#include <stddef.h>
+#include "Event.h"
+#include "Config.h"
+
+//Data structure//
+//--------------//
+typedef struct
+{
+    size_t sequence; //relative to the slot index, so that a zeroed queue is empty
+    Event event;
+} EventQueue_Slot;
+typedef struct
+{
+    EventQueue_Slot slots[EVENT_QUEUE_SIZE];
+    size_t enqueuePosition; //claimed by the producers
+    size_t dequeuePosition; //only written by the consumer
+} EventQueue;
+
+//Methods//
+//-------//
+//Adds an event, callable from any thread, returns false if the queue is full
+bool EventQueue_Push(EventQueue *queue, Event *event);
+//Takes the oldest event, only to be called by the consumer, returns false if the queue is empty
+bool EventQueue_Pop(EventQueue *queue, Event *event);
+//Whether there is no event to take, only to be called by the consumer
+bool EventQueue_Empty(EventQueue *queue);
+
+#endif
@@ -0,0 +1,93 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Executor.h"
+
+static void Executor_Invoke(NAR *nar, Event *execution)
+{
+    int operationID = Narsese_getOperationID(&execution->term);
+    Term args = {0};
+    if(!Narsese_isOperator(execution->term.atoms[0])) //<args --> ^op>
+    {
+        args = Term_ExtractSubterm(&execution->term, 1);
+    }
+    nar->executedOperationID = operationID;
+    (*Memory_GetOperation(nar, operationID)->action)(nar, args);
+    //completion event, the operator feedback
+    while(!NAR_QueueInput(nar, execution->term, EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false))
+    {
+        sched_yield();
+    }
+    __atomic_add_fetch(&nar->feedbackPending, 1, __ATOMIC_RELEASE);
+    __atomic_add_fetch(&nar->operationsCompleted, 1, __ATOMIC_RELAXED);
+}
+
+static void *Executor_Run(void *instance)
+{
+    NAR *nar = instance;
+    for(;;)
+    {
+        sem_wait(&nar->executorWakeup);
+        Event execution;
+        while(EventQueue_Pop(&nar->dispatches, &execution))
+        {
+            Executor_Invoke(nar, &execution);
+        }
+        if(__atomic_load_n(&nar->executorStopRequested, __ATOMIC_ACQUIRE))
+        {
+            return NULL;
+        }
+    }
+}
+
+void Executor_Start(NAR *nar)
+{
+    assert(!nar->executorActive, "The executor of this instance is already active");
+    nar->executorStopRequested = false;
+    assert(sem_init(&nar->executorWakeup, 0, 0) == 0, "Executor semaphore could not be created");
+    nar->executorActive = true;
+    assert(pthread_create(&nar->executorThread, NULL, Executor_Run, nar) == 0, "Executor thread could not be started");
+}
+
+bool Executor_Dispatch(NAR *nar, Event *execution)
+{
+    if(!EventQueue_Push(&nar->dispatches, execution))
+    {
+        return false;
+    }
+    sem_post(&nar->executorWakeup);
+    return true;
+}
+
+void Executor_Stop(NAR *nar)
+{
+    if(nar->executorActive)
+    {
+        __atomic_store_n(&nar->executorStopRequested, true, __ATOMIC_RELEASE);
+        sem_post(&nar->executorWakeup);
+        pthread_join(nar->executorThread, NULL);
+        sem_destroy(&nar->executorWakeup);
+        nar->executorActive = false;
+    }
+}
@@ -22,42 +22,30 @@
  * THE SOFTWARE.
  */
 
-#ifndef STACK_H
-#define STACK_H
+#ifndef H_EXECUTOR
+#define H_EXECUTOR
 
-/////////////
-//  Stack  //
-/////////////
-//The stack for use by the hashtable
+//////////////////////////
+//  Operation executor  //
+//////////////////////////
+//Invokes the actions of the executed operations on its own thread, so that a slow actuator doesn't stall reasoning.
+//Decisions are dispatched to it through a queue, and once an action returned,
+//its operator feedback is queued as completion event which is added at the start of the next cycle.
 
 //References//
 //-----------//
-#include <stdlib.h>
-#include <stdbool.h>
-#include "Concept.h"
-
-//Data structure//
-//--------------//
-typedef struct
-{
-    Concept *value; //the key is value->term
-    void *next;
-} VMItem;
-
-typedef struct
-{
-    VMItem* items[CONCEPTS_MAX];
-    int stackpointer;
-} Stack;
+#include <pthread.h>
+#include <semaphore.h>
+#include <sched.h>
+#include "NAR.h"
 
 //Methods//
 //-------//
-//Add a VMItem on the top of the stack
-void Stack_Push(Stack *stack, VMItem *item);
-//Remove a VMItem from the top of the stack
-VMItem *Stack_Pop(Stack *stack);
-//Check if there aren't VMItems left on the stack
-bool Stack_IsEmpty(Stack *stack);
+//Starts invoking the actions of dispatched operations on a new thread
+void Executor_Start(NAR *nar);
+//Dispatches an operation, the event of the operation term, returns false if the queue is full
+bool Executor_Dispatch(NAR *nar, Event *execution);
+//Stops the executor thread once the dispatched operations are executed
+void Executor_Stop(NAR *nar);
 
 #endif
-
@@ -35,3 +35,36 @@ void assert(bool b, char* message)
         exit(1);
     }
 }
+
+void Random_Seed(Random *random, unsigned int seed)
+{
+    //additive feedback generator x[i] = x[i-3] + x[i-31], seeded by a Lehmer generator
+    int32_t word = seed == 0 ? 1 : seed;
+    random->state[0] = word;
+    for(int i=1; i<31; i++)
+    {
+        int32_t hi = word / 127773;
+        int32_t lo = word % 127773;
+        word = 16807 * lo - 2836 * hi;
+        if(word < 0)
+        {
+            word += 2147483647;
+        }
+        random->state[i] = word;
+    }
+    random->front = 3;
+    random->rear = 0;
+    for(int i=0; i<310; i++) //discard the initial outputs
+    {
+        Random_Next(random);
+    }
+}
+
+int Random_Next(Random *random)
+{
+    uint32_t value = (uint32_t) random->state[random->front] + (uint32_t) random->state[random->rear];
+    random->state[random->front] = (int32_t) value;
+    random->front = (random->front + 1) % 31;
+    random->rear = (random->rear + 1) % 31;
+    return value >> 1;
+}
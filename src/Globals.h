@@ -26,6 +26,8 @@
 #define GLOBALS_H
 
 #include <stdbool.h>
+#include <stdint.h>
+#include "Config.h"
 
 /*-------*/
 /* Flags */
@@ -53,4 +55,47 @@ void assert(bool b, char* message);
 #define MIN(a, b) (((a) < (b)) ? (a) : (b))
 #define MAX(a, b) (((a) > (b)) ? (a) : (b))
 
+/*--------*/
+/* Random */
+/*--------*/
+//Random number generator state, the generator gives each NAR instance its own stream, of the same sequence as glibc's rand()
+typedef struct
+{
+    int32_t state[31];
+    int front;
+    int rear;
+} Random;
+void Random_Seed(Random *random, unsigned int seed);
+int Random_Next(Random *random);
+
+/*---------*/
+/* Numeric */
+/*---------*/
+//Stored truth values and priorities in [0, 1], converted to reals for computation, NUMERIC_ONE being 1.0 and NUMERIC_EPSILON the resolution
+#if NUMERIC_PROFILE == NUMERIC_FIXED16
+typedef uint16_t Numeric;
+#define NUMERIC_ONE 65535
+#define NUMERIC_EPSILON (1.0 / NUMERIC_ONE)
+#define Numeric_FromReal(x) ((Numeric) (MIN(1.0, MAX(0.0, (double) (x))) * NUMERIC_ONE + 0.5))
+#define Numeric_ToReal(x) ((x) * (1.0 / NUMERIC_ONE))
+#elif NUMERIC_PROFILE == NUMERIC_FLOAT
+typedef float Numeric;
+#define NUMERIC_ONE 1.0f
+#define NUMERIC_EPSILON 1e-6
+#define Numeric_FromReal(x) ((Numeric) (x))
+#define Numeric_ToReal(x) ((double) (x))
+#else
+typedef double Numeric;
+#define NUMERIC_ONE 1.0
+#define NUMERIC_EPSILON 0.0
+#define Numeric_FromReal(x) (x)
+#define Numeric_ToReal(x) (x)
+#endif
+
+/*----------*/
+/* Instance */
+/*----------*/
+//Reasoner instance, its state is defined in Memory.h
+typedef struct NAR NAR;
+
 #endif
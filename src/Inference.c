@@ -83,7 +83,7 @@ static Event Inference_EventRevision(Event *a, Event *b)
 Implication Inference_ImplicationRevision(Implication *a, Implication *b)
 {
     DERIVATION_STAMP(a,b)
-    double occurrenceTimeOffsetAvg = weighted_average(a->occurrenceTimeOffset, b->occurrenceTimeOffset, Truth_c2w(a->truth.confidence), Truth_c2w(b->truth.confidence));
+    double occurrenceTimeOffsetAvg = weighted_average(a->occurrenceTimeOffset, b->occurrenceTimeOffset, Truth_c2w(Truth_Confidence(a->truth)), Truth_c2w(Truth_Confidence(b->truth)));
     return (Implication) { .term = a->term,
                            .truth = Truth_Revision(a->truth, b->truth),
                            .stamp = conclusionStamp, 
@@ -144,8 +144,8 @@ Event Inference_IncreasedActionPotential(Event *existing_potential, Event *incom
     }
     else
     {
-        double confExisting = Inference_EventUpdate(existing_potential, currentTime).truth.confidence;
-        double confIncoming = Inference_EventUpdate(incoming_spike, currentTime).truth.confidence;
+        double confExisting = Truth_Confidence(Inference_EventUpdate(existing_potential, currentTime).truth);
+        double confIncoming = Truth_Confidence(Inference_EventUpdate(incoming_spike, currentTime).truth);
         //check if there is evidental overlap
         bool overlap = Stamp_checkOverlap(&incoming_spike->stamp, &existing_potential->stamp);
         //if there is or the terms aren't equal, apply choice, keeping the stronger one:
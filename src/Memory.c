@@ -27,85 +27,214 @@
 double PROPAGATION_THRESHOLD = PROPAGATION_THRESHOLD_INITIAL;
 bool PRINT_DERIVATIONS = PRINT_DERIVATIONS_INITIAL;
 bool PRINT_INPUT = PRINT_INPUT_INITIAL;
-Concept concept_storage[CONCEPTS_MAX];
-Item concept_items_storage[CONCEPTS_MAX];
-Event cycling_event_storage[CYCLING_EVENTS_MAX];
-Item cycling_event_items_storage[CYCLING_EVENTS_MAX];
-double conceptPriorityThreshold = 0.0;
 
-static void Memory_ResetEvents()
+static void Memory_ResetEvents(NAR *nar)
 {
-    FIFO_RESET(&belief_events);
-    FIFO_RESET(&goal_events);
-    PriorityQueue_RESET(&cycling_events, cycling_event_items_storage, CYCLING_EVENTS_MAX);
-    for(int i=0; i<CYCLING_EVENTS_MAX; i++)
+    FIFO_RESET(&nar->belief_events);
+    Event discarded;
+    while(EventQueue_Pop(&nar->inputs, &discarded));
+    while(EventQueue_Pop(&nar->executions, &discarded));
+    nar->executionsDropped = 0;
+    if(!nar->executorActive)
     {
-        cycling_event_storage[i] = (Event) {0};
-        cycling_events.items[i] = (Item) { .address = &(cycling_event_storage[i]) };
+        while(EventQueue_Pop(&nar->dispatches, &discarded));
+    }
+    nar->operationsDispatched = nar->operationsCompleted = 0;
+    nar->feedbackPending = 0;
+    EventBag_RESET(&nar->cycling_events, nar->cycling_event_storage, CYCLING_EVENTS_MAX, nar->cycling_event_buckets, CYCLING_EVENTS_BUCKETS);
+    PriorityQueue_RESET(&nar->goals, nar->goal_items_storage, nar->goal_slots, GOALS_MAX);
+    for(int i=0; i<GOALS_MAX; i++)
+    {
+        nar->goal_storage[i] = (Event) {0};
+        nar->goals.items[i].address = &(nar->goal_storage[i]);
+    }
+    nar->goalsSelected = 0;
+}
+
+static OperationTable *Memory_OperationTableAt(NAR *nar, int index)
+{
+    return index == 0 ? NULL : &nar->operationTableChunks[(index-1) / OPERATION_TABLES_CHUNK_SIZE][(index-1) % OPERATION_TABLES_CHUNK_SIZE];
+}
+
+static int Memory_AllocateOperationTable(NAR *nar)
+{
+    int index = nar->operationTablesFree;
+    if(index != 0)
+    {
+        nar->operationTablesFree = Memory_OperationTableAt(nar, index)->next;
+    }
+    else
+    {
+        int chunk = nar->operationTablesAllocated / OPERATION_TABLES_CHUNK_SIZE;
+        if(nar->operationTablesAllocated % OPERATION_TABLES_CHUNK_SIZE == 0)
+        {
+            assert(chunk < OPERATION_TABLES_CHUNKS_MAX, "Too many operation tables, increase OPERATION_TABLES_CHUNKS_MAX!");
+            nar->operationTableChunks[chunk] = calloc(OPERATION_TABLES_CHUNK_SIZE, sizeof(OperationTable));
+            assert(nar->operationTableChunks[chunk] != NULL, "Not enough memory for operation tables");
+        }
+        index = ++nar->operationTablesAllocated;
+    }
+    nar->operationTablesUsed++;
+    return index;
+}
+
+//Returns the operation tables of a concept which is recycled to the free ones
+static void Memory_FreeOperationTables(NAR *nar, Concept *c)
+{
+    int index = c->operation_tables;
+    while(index != 0)
+    {
+        OperationTable *opTable = Memory_OperationTableAt(nar, index);
+        int next = opTable->next;
+        opTable->next = nar->operationTablesFree;
+        nar->operationTablesFree = index;
+        nar->operationTablesUsed--;
+        index = next;
+    }
+    c->operation_tables = 0;
+}
+
+//Removes the implications which have the concept as source from the tables of all concepts, so that no table refers to it when it's recycled
+static void Memory_RemoveSourcedImplications(NAR *nar, Concept *source)
+{
+    for(int i=0; i<nar->concepts.itemsAmount && source->sourcedImplications > 0; i++)
+    {
+        if(!(nar->concept_flags[nar->concepts.items[i].handle] & CONCEPT_FLAG_IMPLICATIONS))
+        {
+            continue;
+        }
+        Concept *c = nar->concepts.items[i].address;
+        int opi;
+        for(Table *table = Memory_NextPreconditionBeliefs(nar, c, NULL, &opi); table != NULL; table = Memory_NextPreconditionBeliefs(nar, c, table, &opi))
+        {
+            for(int j=0; j<table->itemsAmount; j++)
+            {
+                if(Table_At(table, j)->sourceConcept == source)
+                {
+                    Table_Remove(nar, table, j--);
+                }
+            }
+        }
+    }
+    assert(source->sourcedImplications == 0, "Implications with the concept as source were not found in the tables");
+}
+
+//Releases the implications of the tables of a concept which is recycled from the counts of their source concepts
+static void Memory_ReleaseImplications(NAR *nar, Concept *c)
+{
+    int opi;
+    for(Table *table = Memory_NextPreconditionBeliefs(nar, c, NULL, &opi); table != NULL; table = Memory_NextPreconditionBeliefs(nar, c, table, &opi))
+    {
+        for(int j=0; j<table->itemsAmount; j++)
+        {
+            ((Concept*) Table_At(table, j)->sourceConcept)->sourcedImplications--;
+        }
     }
 }
 
-static void Memory_ResetConcepts()
+static void Memory_ResetOperationTables(NAR *nar)
 {
-    PriorityQueue_RESET(&concepts, concept_items_storage, CONCEPTS_MAX);
+    for(int i=0; i<OPERATION_TABLES_CHUNKS_MAX && nar->operationTableChunks[i] != NULL; i++)
+    {
+        free(nar->operationTableChunks[i]);
+        nar->operationTableChunks[i] = NULL;
+    }
+    nar->operationTablesAllocated = nar->operationTablesUsed = nar->operationTablesFree = 0;
+}
+
+static void Memory_ResetConcepts(NAR *nar)
+{
+    //only the concepts in the queue were ever written to, this keeps the untouched storage of a new instance unmapped
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
+    {
+        Concept *c = nar->concepts.items[i].address;
+        int slot = Memory_ConceptSlot(nar, c);
+        nar->term_concepts[c->term] = NULL;
+        *c = (Concept) {0};
+        nar->concept_priority[slot] = 0;
+        nar->concept_usage[slot] = (Usage) {0};
+        nar->concept_term_hash[slot] = 0;
+        nar->concept_flags[slot] = 0;
+    }
+    TermStore_INIT(&nar->terms);
+    Memory_ResetOperationTables(nar);
+    PriorityQueue_RESET(&nar->concepts, nar->concept_items_storage, nar->concept_slots, CONCEPTS_MAX);
     for(int i=0; i<CONCEPTS_MAX; i++)
     {
-        concept_storage[i] = (Concept) {0};
-        concepts.items[i] = (Item) { .address = &(concept_storage[i]) };
+        nar->concepts.items[i].address = &(nar->concept_storage[i]);
     }
 }
 
-int concept_id = 0;
-void Memory_INIT()
+void Memory_INIT(NAR *nar)
 {
-    HashTable_Init(&HTconcepts);
-    conceptPriorityThreshold = 0.0;
-    Memory_ResetConcepts();
-    Memory_ResetEvents();
-    for(int i=0; i<OPERATIONS_MAX; i++)
+    nar->conceptPriorityThreshold = 0.0;
+    Memory_ResetConcepts(nar);
+    Memory_ResetEvents(nar);
+    for(int i=0; i<nar->operationsAmount; i++)
     {
-        operations[i] = (Operation) {0};
+        nar->operations[i] = (Operation) {0};
     }
-    concept_id = 0;
+    nar->concept_id = 0;
+    nar->eventsSelected = 0;
+    nar->countConceptsMatchedTotal = nar->countConceptsMatchedMax = 0;
+    nar->countRealtimeCycles = nar->countCyclesTruncated = nar->countPropagationIterationsSkipped = 0;
+    nar->countCyclesSkipped = 0;
+    nar->countConceptInferences = nar->countConceptInferencesSkipped = 0;
+    nar->maxDeadlineOverrunMs = 0;
+    //the memoised subgoals refer to the concepts which were reset
+    for(int i=0; i<PLANS_MAX; i++)
+    {
+        nar->plans[i].amount = 0;
+        nar->plans[i].lastUsed = 0;
+    }
+    nar->planningExpansions = nar->plansReused = nar->plansInvalidated = 0;
+    nar->traceRule = TRACE_RULE_SENSORIMOTOR;
+    Query_INIT(nar);
 }
 
-Concept *Memory_FindConceptByTerm(Term *term)
+Concept *Memory_FindConceptByTerm(NAR *nar, Term *term)
 {
-    return HashTable_Get(&HTconcepts, term);
+    TermHandle handle = TermStore_Find(&nar->terms, term);
+    return handle != 0 ? nar->term_concepts[handle] : NULL;
 }
 
-Concept* Memory_Conceptualize(Term *term, long currentTime)
+Concept* Memory_Conceptualize(NAR *nar, Term *term, long currentTime)
 {
     if(Narsese_isOperation(term)) //don't conceptualize operations
     {
         return NULL;
     }
-    Concept *ret = Memory_FindConceptByTerm(term);
+    Concept *ret = Memory_FindConceptByTerm(nar, term);
     if(ret == NULL)
     {
         Concept *recycleConcept = NULL;
         //try to add it, and if successful add to voting structure
-        PriorityQueue_Push_Feedback feedback = PriorityQueue_Push(&concepts, 1);
+        PriorityQueue_Push_Feedback feedback = PriorityQueue_Push(&nar->concepts, 1);
         if(feedback.added)
         {
             recycleConcept = feedback.addedItem.address;
-            //if something was evicted in the adding process delete from hashmap first
+            //if something was evicted in the adding process release its term first
             if(feedback.evicted)
             {
-                IN_DEBUG( assert(HashTable_Get(&HTconcepts, &recycleConcept->term) != NULL, "VMItem to delete does not exist!"); )
-                HashTable_Delete(&HTconcepts, recycleConcept);
-                IN_DEBUG( assert(HashTable_Get(&HTconcepts, &recycleConcept->term) == NULL, "VMItem to delete was not deleted!"); )
+                IN_DEBUG( assert(nar->term_concepts[recycleConcept->term] == recycleConcept, "Evicted concept is not the one of its term!"); )
+                Query_Removed(nar, Memory_ConceptTerm(nar, recycleConcept));
+                nar->term_concepts[recycleConcept->term] = NULL;
+                TermStore_Release(&nar->terms, recycleConcept->term);
+                Memory_RemoveSourcedImplications(nar, recycleConcept);
+                Memory_ReleaseImplications(nar, recycleConcept);
             }
             //proceed with recycling of the concept in the priority queue
+            Memory_FreeOperationTables(nar, recycleConcept);
             *recycleConcept = (Concept) {0};
-            Concept_SetTerm(recycleConcept, *term);
-            recycleConcept->id = concept_id;
-            recycleConcept->usage = (Usage) { .useCount = 1, .lastUsed = currentTime };
-            concept_id++;
-            //also add added concept to HashMap:
-            IN_DEBUG( assert(HashTable_Get(&HTconcepts, &recycleConcept->term) == NULL, "VMItem to add already exists!"); )
-            HashTable_Set(&HTconcepts, recycleConcept);
-            IN_DEBUG( assert(HashTable_Get(&HTconcepts, &recycleConcept->term) != NULL, "VMItem to add was not added!"); )
+            recycleConcept->term = TermStore_Intern(&nar->terms, term);
+            nar->term_concepts[recycleConcept->term] = recycleConcept;
+            recycleConcept->id = nar->concept_id;
+            int slot = Memory_ConceptSlot(nar, recycleConcept);
+            nar->concept_priority[slot] = 0;
+            nar->concept_usage[slot] = (Usage) { .useCount = 1, .lastUsed = currentTime };
+            nar->concept_term_hash[slot] = TermStore_Hash(&nar->terms, recycleConcept->term);
+            nar->concept_flags[slot] = Variable_hasVariable(term, true, true, true) ? CONCEPT_FLAG_VARIABLES : 0;
+            nar->concept_id++;
             return recycleConcept;
         }
     }
@@ -116,22 +245,15 @@ Concept* Memory_Conceptualize(Term *term, long currentTime)
     return NULL;
 }
 
-Event selectedEvents[EVENT_SELECTIONS]; //better to be global
-double selectedEventsPriority[EVENT_SELECTIONS]; //better to be global
-int eventsSelected = 0;
-
-static bool Memory_containsEvent(Event *event)
+static bool Memory_containsEvent(NAR *nar, Event *event)
 {
-    for(int i=0; i<cycling_events.itemsAmount; i++)
+    if(EventBag_Contains(&nar->cycling_events, event))
     {
-        if(Event_Equal(event, cycling_events.items[i].address))
-        {
-            return true;
-        }
+        return true;
     }
-    for(int i=0; i<eventsSelected; i++)
+    for(int i=0; i<nar->eventsSelected; i++)
     {
-        if(Event_Equal(event, &selectedEvents[i]))
+        if(Event_Equal(event, &nar->selectedEvents[i]))
         {
             return true;
         }
@@ -141,14 +263,14 @@ static bool Memory_containsEvent(Event *event)
 
 //Add event for cycling through the system (inference and context)
 //called by addEvent for eternal knowledge
-static bool Memory_addCyclingEvent(Event *e, double priority, long currentTime)
+static bool Memory_addCyclingEvent(NAR *nar, Event *e, double priority, long currentTime)
 {
     assert(e->type == EVENT_TYPE_BELIEF, "Only belief events cycle, goals have their own mechanism!");
-    if(Memory_containsEvent(e))
+    if(Memory_containsEvent(nar, e))
     {
         return false;
     }
-    Concept *c = Memory_FindConceptByTerm(&e->term);
+    Concept *c = Memory_FindConceptByTerm(nar, &e->term);
     if(c != NULL)
     {
         if(e->type == EVENT_TYPE_BELIEF && c->belief.type != EVENT_TYPE_DELETED && ((e->occurrenceTime == OCCURRENCE_ETERNAL && c->belief.truth.confidence > e->truth.confidence) || (e->occurrenceTime != OCCURRENCE_ETERNAL && Truth_Projection(c->belief_spike.truth, c->belief_spike.occurrenceTime, currentTime).confidence > Truth_Projection(e->truth, e->occurrenceTime, currentTime).confidence)))
@@ -156,40 +278,77 @@ static bool Memory_addCyclingEvent(Event *e, double priority, long currentTime)
             return false; //the belief has a higher confidence and was already revised up (or a cyclic transformation happened!), get rid of the event!
         }   //more radical than OpenNARS!
     }
-    PriorityQueue_Push_Feedback feedback = PriorityQueue_Push(&cycling_events, priority);
+    return EventBag_Add(&nar->cycling_events, e, priority);
+}
+
+void Memory_addGoal(NAR *nar, Event *goal, double priority, bool readded)
+{
+    assert(goal->type == EVENT_TYPE_GOAL, "Only goals can become active goals!");
+    if(priority < GOAL_PRIORITY_MIN)
+    {
+        return;
+    }
+    for(int i=0; i<nar->goals.itemsAmount; i++)
+    {
+        if(Term_Equal(&goal->term, &((Event*) nar->goals.items[i].address)->term))
+        {
+            if(!readded) //else the goal was input again while it was processed
+            {
+                *((Event*) nar->goals.items[i].address) = *goal;
+                PriorityQueue_Update(&nar->goals, i, priority);
+            }
+            return;
+        }
+    }
+    PriorityQueue_Push_Feedback feedback = PriorityQueue_Push(&nar->goals, priority);
     if(feedback.added)
     {
-        Event *toRecyle = feedback.addedItem.address;
-        *toRecyle = *e;
-        return true;
+        *((Event*) feedback.addedItem.address) = *goal;
     }
-    return false;
 }
 
 static void Memory_printAddedKnowledge(Term *term, char type, Truth *truth, long occurrenceTime, double priority, bool input, bool derived, bool revised)
 {
     if(((input && PRINT_INPUT) || PRINT_DERIVATIONS) && priority > PRINT_DERIVATIONS_PRIORITY_THRESHOLD && (input || derived || revised))
     {
-        fputs(revised ? "Revised: " : (input ? "Input: " : "Derived: "), stdout);
+        if(!input)
+        {
+            Output_MarkDroppable();
+        }
+        Output_Puts(revised ? "Revised: " : (input ? "Input: " : "Derived: "));
         Narsese_PrintTerm(term);
-        fputs((type == EVENT_TYPE_BELIEF ? ". " : "! "), stdout);
-        printf(occurrenceTime == OCCURRENCE_ETERNAL ? "" : ":|: occurrenceTime=%ld ", occurrenceTime);
-        printf("Priority=%f ", priority);
+        Output_Puts(type == EVENT_TYPE_BELIEF ? ". " : "! ");
+        Output_Printf(occurrenceTime == OCCURRENCE_ETERNAL ? "" : ":|: occurrenceTime=%ld ", occurrenceTime);
+        Output_Printf("Priority=%f ", priority);
         Truth_Print(truth);
     }
 }
 
-void Memory_printAddedEvent(Event *event, double priority, bool input, bool derived, bool revised)
+static void Memory_reportAddedKnowledge(NAR *nar, Term *term, char type, Truth *truth, long occurrenceTime, double priority, int flags)
+{
+    if(nar->knowledgeHandler != NULL && (flags & (TRACE_FLAG_INPUT | TRACE_FLAG_DERIVED | TRACE_FLAG_REVISED)))
+    {
+        nar->knowledgeHandler(nar, term, type, truth, occurrenceTime, priority, flags);
+    }
+}
+
+void Memory_printAddedEvent(NAR *nar, Event *event, double priority, bool input, bool derived, bool revised)
 {
+    int flags = (input ? TRACE_FLAG_INPUT : 0) | (derived ? TRACE_FLAG_DERIVED : 0) | (revised ? TRACE_FLAG_REVISED : 0);
     Memory_printAddedKnowledge(&event->term, event->type, &event->truth, event->occurrenceTime, priority, input, derived, revised);
+    Memory_reportAddedKnowledge(nar, &event->term, event->type, &event->truth, event->occurrenceTime, priority, flags);
+    Trace_Knowledge(&event->term, event->type, &event->truth, &event->stamp, event->occurrenceTime, event->creationTime, priority, flags, nar->traceRule);
 }
 
-void Memory_printAddedImplication(Term *implication, Truth *truth, bool input, bool revised)
+void Memory_printAddedImplication(NAR *nar, Implication *imp, bool input, bool revised)
 {
-    Memory_printAddedKnowledge(implication, EVENT_TYPE_BELIEF, truth, OCCURRENCE_ETERNAL, 1, input, true, revised);
+    int flags = TRACE_FLAG_IMPLICATION | (input ? TRACE_FLAG_INPUT : TRACE_FLAG_DERIVED) | (revised ? TRACE_FLAG_REVISED : 0);
+    Memory_printAddedKnowledge(&imp->term, EVENT_TYPE_BELIEF, &imp->truth, OCCURRENCE_ETERNAL, 1, input, true, revised);
+    Memory_reportAddedKnowledge(nar, &imp->term, EVENT_TYPE_BELIEF, &imp->truth, OCCURRENCE_ETERNAL, 1, flags);
+    Trace_Knowledge(&imp->term, EVENT_TYPE_BELIEF, &imp->truth, &imp->stamp, OCCURRENCE_ETERNAL, imp->creationTime, 1, flags, nar->traceRule);
 }
 
-void Memory_addEvent(Event *event, long currentTime, double priority, bool input, bool derived, bool readded, bool revised)
+void Memory_addEvent(NAR *nar, Event *event, long currentTime, double priority, bool input, bool derived, bool readded, bool revised)
 {
     if(readded) //readded events get durability applied, they already got complexity-penalized
     {
@@ -201,7 +360,7 @@ void Memory_addEvent(Event *event, long currentTime, double priority, bool input
         double complexity = Term_Complexity(&event->term);
         priority *= 1.0 / log2(1.0 + complexity);
     }
-    if(event->truth.confidence < MIN_CONFIDENCE || priority < MIN_PRIORITY)
+    if(Truth_Confidence(event->truth) < MIN_CONFIDENCE || priority < MIN_PRIORITY)
     {
         return;
     }
@@ -212,13 +371,13 @@ void Memory_addEvent(Event *event, long currentTime, double priority, bool input
             //process event
             if(event->type == EVENT_TYPE_BELIEF)
             {
-                FIFO_Add(event, &belief_events); //not revised yet
+                FIFO_Add(event, &nar->belief_events); //not revised yet
             }
             else
             if(event->type == EVENT_TYPE_GOAL)
             {
-                FIFO_Add(event, &goal_events);
-                Memory_printAddedEvent(event, priority, input, derived, revised);
+                Memory_addGoal(nar, event, priority * Truth_Expectation(event->truth), false);
+                Memory_printAddedEvent(nar, event, priority, input, derived, revised);
             }
         }
     }
@@ -238,7 +397,7 @@ void Memory_addEvent(Event *event, long currentTime, double priority, bool input
                 //get predicate and add the subject to precondition table as an implication
                 Term subject = Term_ExtractSubterm(&event->term, 1);
                 Term predicate = Term_ExtractSubterm(&event->term, 2);
-                Concept *target_concept = Memory_Conceptualize(&predicate, currentTime);
+                Concept *target_concept = Memory_Conceptualize(nar, &predicate, currentTime);
                 if(target_concept != NULL) // && Memory_FindConceptByTerm(&subject, &source_concept_i))
                 {
                     Implication imp = { .truth = eternal_event.truth,
@@ -264,7 +423,7 @@ void Memory_addEvent(Event *event, long currentTime, double priority, bool input
                     {
                         sourceConceptTerm = subject;
                     }
-                    Concept *sourceConcept = Memory_Conceptualize(&sourceConceptTerm, currentTime);
+                    Concept *sourceConcept = Memory_Conceptualize(nar, &sourceConceptTerm, currentTime);
                     imp.sourceConceptId = sourceConcept->id;
                     if(sourceConcept != NULL)
                     {
@@ -272,39 +431,43 @@ void Memory_addEvent(Event *event, long currentTime, double priority, bool input
                         imp.term.atoms[0] = Narsese_AtomicTermIndex("$");
                         Term_OverrideSubterm(&imp.term, 1, &subject);
                         Term_OverrideSubterm(&imp.term, 2, &predicate);
-                        Table_AddAndRevise(&target_concept->precondition_beliefs[opi], &imp);
-                        Memory_printAddedEvent(event, priority, input, derived, revised);
+                        Table_AddAndRevise(nar, Memory_PreconditionBeliefs(nar, target_concept, opi, true), &imp);
+                        Memory_printAddedEvent(nar, event, priority, input, derived, revised);
                     }
                 }
                 return; //at this point, either the implication has been added or there was no space for its precondition concept
             }
-            Concept *c = Memory_Conceptualize(&event->term, currentTime);
+            Concept *c = Memory_Conceptualize(nar, &event->term, currentTime);
             if(c != NULL)
             {
-                c->priority = MAX(c->priority, priority);
+                int slot = Memory_ConceptSlot(nar, c);
+                nar->concept_priority[slot] = MAX(nar->concept_priority[slot], Numeric_FromReal(priority));
                 if(event->occurrenceTime != OCCURRENCE_ETERNAL && event->occurrenceTime <= currentTime)
                 {
                     c->belief_spike = Inference_IncreasedActionPotential(&c->belief_spike, event, currentTime, NULL);
                     c->belief_spike.creationTime = currentTime; //for metrics
+                    Query_UpdateBelief(nar, &c->belief_spike, true, currentTime);
                 }
                 if(event->occurrenceTime != OCCURRENCE_ETERNAL && event->occurrenceTime > currentTime)
                 {
                     c->predicted_belief = Inference_IncreasedActionPotential(&c->predicted_belief, event, currentTime, NULL);
                     c->predicted_belief.creationTime = currentTime;
+                    Query_UpdateBelief(nar, &c->predicted_belief, true, currentTime);
                 }
                 bool revision_happened = false;
                 c->belief = Inference_IncreasedActionPotential(&c->belief, &eternal_event, currentTime, &revision_happened);
                 c->belief.creationTime = currentTime; //for metrics
+                Query_UpdateBelief(nar, &c->belief, false, currentTime);
                 if(revision_happened)
                 {
-                    Memory_addEvent(&c->belief, currentTime, priority, false, false, false, true);
+                    Memory_addEvent(nar, &c->belief, currentTime, priority, false, false, false, true);
                 }
             }
         }
-        Memory_addCyclingEvent(event, priority, currentTime);
+        Memory_addCyclingEvent(nar, event, priority, currentTime);
         if(input || !readded) //task gets replaced with revised one, more radical than OpenNARS!!
         {
-            Memory_printAddedEvent(event, priority, input, derived, revised);
+            Memory_printAddedEvent(nar, event, priority, input, derived, revised);
         }
     }
     if(event->occurrenceTime == OCCURRENCE_ETERNAL && event->type == EVENT_TYPE_GOAL)
@@ -314,14 +477,90 @@ void Memory_addEvent(Event *event, long currentTime, double priority, bool input
     assert(event->type == EVENT_TYPE_BELIEF || event->type == EVENT_TYPE_GOAL, "Errornous event type");
 }
 
-void Memory_addInputEvent(Event *event, long currentTime)
+void Memory_addInputEvent(NAR *nar, Event *event, long currentTime)
 {
-    Memory_addEvent(event, currentTime, 1, true, false, false, false);
+    Memory_addEvent(nar, event, currentTime, 1, true, false, false, false);
+}
+
+void Memory_addOperation(NAR *nar, int id, Operation op)
+{
+    assert(id > 0 && id <= OPERATIONS_MAX, "Wrong operation id");
+    if(id > nar->operationsAmount)
+    {
+        nar->operations = realloc(nar->operations, id * sizeof(Operation));
+        assert(nar->operations != NULL, "Not enough memory for the operation");
+        for(int i=nar->operationsAmount; i<id; i++)
+        {
+            nar->operations[i] = (Operation) {0};
+        }
+        nar->operationsAmount = id;
+    }
+    nar->operations[id - 1] = op;
+}
+
+Operation *Memory_GetOperation(NAR *nar, int id)
+{
+    return id > 0 && id <= nar->operationsAmount && nar->operations[id - 1].action != NULL ? &nar->operations[id - 1] : NULL;
+}
+
+Table *Memory_PreconditionBeliefs(NAR *nar, Concept *c, int operationID, bool create)
+{
+    if(create)
+    {
+        nar->concept_flags[Memory_ConceptSlot(nar, c)] |= CONCEPT_FLAG_IMPLICATIONS;
+    }
+    if(operationID == 0)
+    {
+        return &c->precondition_beliefs;
+    }
+    //the tables are ordered by operation ID, find the one or where to insert it
+    int *link = &c->operation_tables;
+    OperationTable *opTable;
+    while((opTable = Memory_OperationTableAt(nar, *link)) != NULL && opTable->operationID < operationID)
+    {
+        link = &opTable->next;
+    }
+    if(opTable != NULL && opTable->operationID == operationID)
+    {
+        return &opTable->table;
+    }
+    if(!create)
+    {
+        return NULL;
+    }
+    int index = Memory_AllocateOperationTable(nar);
+    OperationTable *added = Memory_OperationTableAt(nar, index);
+    added->table.itemsAmount = 0;
+    added->table.slotsAmount = 0;
+    added->table.revision = 0;
+    added->operationID = operationID;
+    added->next = *link;
+    *link = index;
+    return &added->table;
+}
+
+Table *Memory_NextPreconditionBeliefs(NAR *nar, Concept *c, Table *table, int *operationID)
+{
+    if(table == NULL)
+    {
+        *operationID = 0;
+        return &c->precondition_beliefs;
+    }
+    OperationTable *next = Memory_OperationTableAt(nar, table == &c->precondition_beliefs ? c->operation_tables : ((OperationTable*) table)->next);
+    if(next == NULL)
+    {
+        return NULL;
+    }
+    *operationID = next->operationID;
+    return &next->table;
 }
 
-void Memory_addOperation(int id, Operation op)
+void Memory_Free(NAR *nar)
 {
-    operations[id - 1] = op;
+    Memory_ResetOperationTables(nar);
+    free(nar->operations);
+    nar->operations = NULL;
+    nar->operationsAmount = 0;
 }
 
 bool Memory_ImplicationValid(Implication *imp)
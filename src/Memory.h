@@ -34,8 +34,14 @@
 //////////////
 #include "Concept.h"
 #include "PriorityQueue.h"
+#include "EventBag.h"
 #include "Config.h"
-#include "HashTable.h"
+#include "Trace.h"
+#include "EventQueue.h"
+#include "Plan.h"
+#include <stdlib.h>
+#include <pthread.h>
+#include <semaphore.h>
 
 //Parameters//
 //----------//
@@ -43,48 +49,147 @@
 extern double PROPAGATION_THRESHOLD;
 extern bool PRINT_DERIVATIONS;
 extern bool PRINT_INPUT;
-extern double conceptPriorityThreshold;
 
 //Data structure//
 //--------------//
-extern Event selectedEvents[EVENT_SELECTIONS]; //better to be global
-extern double selectedEventsPriority[EVENT_SELECTIONS]; //better to be global
-extern int eventsSelected;
-//Concepts in main memory:
-PriorityQueue concepts;
-//cycling events cycling in main memory:
-PriorityQueue cycling_events;
-//Hashtable of concepts used for fast retrieval of concepts via term:
-HashTable HTconcepts;
-//Input event buffers:
-FIFO belief_events;
-FIFO goal_events;
-typedef void (*Action)(Term);
+typedef void (*Action)(NAR *nar, Term args);
 typedef struct
 {
     Term term;
     Action action;
 }Operation;
-Operation operations[OPERATIONS_MAX];
+//Informed about knowledge added to memory, the flags are the ones of the trace
+typedef void (*KnowledgeHandler)(NAR *nar, Term *term, char type, Truth *truth, long occurrenceTime, double priority, int flags);
+//The state of a reasoner instance, instances share nothing but the atom table and the parameters
+struct NAR
+{
+    //Concepts in main memory:
+    PriorityQueue concepts;
+    //cycling events cycling in main memory:
+    EventBag cycling_events;
+    //Interned terms of the concepts, and the concept of each, for fast retrieval of concepts via term:
+    TermStore terms;
+    Concept *term_concepts[INTERNED_TERMS_MAX+1];
+    //Input event buffer:
+    FIFO belief_events;
+    //Active goals, by desire:
+    PriorityQueue goals;
+    //Registered operations, indexed by operator index-1, grown as operations are added:
+    Operation *operations;
+    int operationsAmount;
+    //Standing questions:
+    Queries queries;
+    //Storage the priority queues point into:
+    Concept concept_storage[CONCEPTS_MAX];
+    Item concept_items_storage[CONCEPTS_MAX];
+    int concept_slots[CONCEPTS_MAX];
+    //Frequently read fields of the concepts, indexed by storage slot, so that the sweeps over all concepts don't touch their tables:
+    Numeric concept_priority[CONCEPTS_MAX];
+    Usage concept_usage[CONCEPTS_MAX];
+    TERM_HASH_TYPE concept_term_hash[CONCEPTS_MAX]; //unreduced term hash, terms without variables only match equal hashes
+    char concept_flags[CONCEPTS_MAX];
+    EventBag_Item cycling_event_storage[CYCLING_EVENTS_MAX];
+    int cycling_event_buckets[CYCLING_EVENTS_BUCKETS];
+    Event goal_storage[GOALS_MAX];
+    Item goal_items_storage[GOALS_MAX];
+    int goal_slots[GOALS_MAX];
+    //Implication tables of the operations, shared by the concepts and allocated in chunks as they are used:
+    OperationTable *operationTableChunks[OPERATION_TABLES_CHUNKS_MAX];
+    int operationTablesAllocated;
+    int operationTablesUsed;
+    int operationTablesFree; //first of the free tables, 0 if none
+    //Events selected for inference in the current cycle:
+    Event selectedEvents[EVENT_SELECTIONS];
+    double selectedEventsPriority[EVENT_SELECTIONS];
+    int eventsSelected;
+    //Goals selected for processing in the current cycle:
+    Event selectedGoals[GOAL_SELECTIONS];
+    double selectedGoalsPriority[GOAL_SELECTIONS];
+    int goalsSelected;
+    //Adaptive priority threshold of the concepts to match selected events with:
+    double conceptPriorityThreshold;
+    long countConceptsMatchedTotal;
+    long countConceptsMatchedMax;
+    //Concepts in descending priority order, for anytime inference in real-time mode:
+    Concept *conceptsByPriority[CONCEPTS_MAX];
+    int conceptsByPriorityAmount;
+    //Memoised subgoals of the best-first planner and its statistics:
+    Plan plans[PLANS_MAX];
+    long planningExpansions;
+    long plansReused;
+    long plansInvalidated;
+    //Real-time mode statistics:
+    long countRealtimeCycles;
+    long countCyclesTruncated;
+    long countPropagationIterationsSkipped;
+    long countConceptInferences;
+    long countConceptInferencesSkipped;
+    double maxDeadlineOverrunMs;
+    long countCyclesSkipped; //idle cycles applied at once
+    long currentTime;
+    long concept_id;
+    long base; //evidental base ID of the next input event
+    long stampID; //evidental base ID of the next anticipation, counting downwards
+    Random random; //random number generator state
+    int traceRule; //rule which derived the knowledge being added, for the trace
+    pthread_mutex_t derivationLock; //serializes the parallel inference's additions to memory
+    //Input events added by other threads, added to memory at the start of the next cycle:
+    EventQueue inputs;
+    //Operation executions delivered to the application while the runner thread drives the instance:
+    EventQueue executions;
+    long executionsDropped;
+    //Background cycle runner:
+    pthread_t runnerThread;
+    bool runnerActive;
+    bool runnerStopRequested;
+    double runnerCyclesPerSecond;
+    //Operation executor, invoking the actions on its own thread:
+    EventQueue dispatches;
+    pthread_t executorThread;
+    sem_t executorWakeup;
+    bool executorActive;
+    bool executorStopRequested;
+    long operationsDispatched;
+    long operationsCompleted;
+    int feedbackPending; //operator feedback events queued since the last cycle started
+    //Hooks of the embedding API:
+    void *owner; //handle the instance is embedded in
+    KnowledgeHandler knowledgeHandler; //informed about added input, derived and revised knowledge if set
+    int executedOperationID; //operation whose action is running
+};
 
 //Methods//
 //-------//
+//Storage slot of a concept, the index into the hot arrays
+#define Memory_ConceptSlot(nar, c) ((int) ((Concept*) (c) - (nar)->concept_storage))
+//The term of a concept
+#define Memory_ConceptTerm(nar, c) TermStore_Term(&(nar)->terms, (c)->term)
 //Init memory
-void Memory_INIT();
+void Memory_INIT(NAR *nar);
 //Find a concept
-Concept *Memory_FindConceptByTerm(Term *term);
+Concept *Memory_FindConceptByTerm(NAR *nar, Term *term);
 //Create a new concept
-Concept* Memory_Conceptualize(Term *term, long currentTime);
+Concept* Memory_Conceptualize(NAR *nar, Term *term, long currentTime);
 //Add event to memory
-void Memory_addEvent(Event *event, long currentTime, double priority, bool input, bool derived, bool readded, bool revised);
-void Memory_addInputEvent(Event *event, long currentTime);
+void Memory_addEvent(NAR *nar, Event *event, long currentTime, double priority, bool input, bool derived, bool readded, bool revised);
+void Memory_addInputEvent(NAR *nar, Event *event, long currentTime);
+//Add goal to the active goals, replacing an active goal of the same term unless it's readded after processing
+void Memory_addGoal(NAR *nar, Event *goal, double priority, bool readded);
 //Add operation to memory
-void Memory_addOperation(int id, Operation op);
-//check if implication is still valid (source concept might be forgotten)
+void Memory_addOperation(NAR *nar, int id, Operation op);
+//The registered operation of the id, NULL if there is none
+Operation *Memory_GetOperation(NAR *nar, int id);
+//The table of the implications with the operation (0 for none) which have the concept as postcondition, NULL if it doesn't exist and shouldn't be created
+Table *Memory_PreconditionBeliefs(NAR *nar, Concept *c, int operationID, bool create);
+//Iterates the implication tables of the concept, the one without operation first, starting with table NULL, returns NULL after the last
+Table *Memory_NextPreconditionBeliefs(NAR *nar, Concept *c, Table *table, int *operationID);
+//Free the storage allocated by the memory
+void Memory_Free(NAR *nar);
+//check if implication is still valid, the memory removes the implications of a concept it recycles from the tables
 bool Memory_ImplicationValid(Implication *imp);
 //print added implication
-void Memory_printAddedImplication(Term *implication, Truth *truth, bool input, bool revised);
+void Memory_printAddedImplication(NAR *nar, Implication *imp, bool input, bool revised);
 //print added event
-void Memory_printAddedEvent(Event *event, double priority, bool input, bool derived, bool revised);
+void Memory_printAddedEvent(NAR *nar, Event *event, double priority, bool input, bool derived, bool revised);
 
 #endif
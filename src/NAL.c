@@ -25,17 +25,22 @@
 #include "NAL.h"
 
 int ruleID = 0;
+static bool generateRuleNames = false;
+//upper case atoms are treated as variables in the meta rule language
+static bool NAL_IsMetaVariable(Atom atom)
+{
+    return atom && Narsese_atomNames[atom-1][0] >= 'A' && Narsese_atomNames[atom-1][0] <= 'Z';
+}
+
 static void NAL_GeneratePremisesUnifier(int i, Atom atom, int premiseIndex)
 {
     if(atom)
     {
-        //upper case atoms are treated as variables in the meta rule language
-        if(Narsese_atomNames[atom-1][0] >= 'A' && Narsese_atomNames[atom-1][0] <= 'Z')
+        if(NAL_IsMetaVariable(atom))
         {
-            //unification failure by inequal value assignment (value at position i versus previously assigned one), and variable binding
-            printf("subtree = Term_ExtractSubterm(&term%d, %d);\n", premiseIndex, i);
-            printf("if(substitutions[%d].atoms[0]!=0 && !Term_Equal(&substitutions[%d], &subtree)){ goto RULE_%d; }\n", atom, atom, ruleID);
-            printf("substitutions[%d] = subtree;\n", atom);
+            //unification failure by inequal value assignment (value at position i versus previously assigned one, compared in place), or variable binding
+            printf("if(substitutions[%d].atoms[0]!=0){ if(!Term_SubtermEqual(&substitutions[%d], 0, &term%d, %d)){ goto RULE_%d; } }\n", atom, atom, premiseIndex, i, ruleID);
+            printf("else { substitutions[%d] = Term_ExtractSubterm(&term%d, %d); }\n", atom, premiseIndex, i);
         }
         else
         {
@@ -49,7 +54,7 @@ static void NAL_GenerateConclusionSubstitution(int i, Atom atom)
 {
     if(atom)
     {
-        if(Narsese_atomNames[atom-1][0] >= 'A' && Narsese_atomNames[atom-1][0] <= 'Z')
+        if(NAL_IsMetaVariable(atom))
         {
             //conclusion term gets variables substituted
             printf("if(!Term_OverrideSubterm(&conclusion,%d,&substitutions[%d])){ goto RULE_%d; }\n", i, atom, ruleID);
@@ -71,7 +76,22 @@ static void NAL_GenerateConclusionTerm(char *premise1, char *premise2, char* con
     //skip double/single premise rule if single/double premise
     if(doublePremise) { printf("if(!doublePremise) { goto RULE_%d; }\n", ruleID); }
     if(!doublePremise) { printf("if(doublePremise) { goto RULE_%d; }\n", ruleID); }
-    puts("Term substitutions[TERMS_MAX] = {0}; Term subtree = {0};");
+    //only the variables of the rule are unbound, instead of clearing a substitution for every atom
+    puts("Term substitutions[TERMS_MAX];");
+    bool unbound[TERMS_MAX] = {0};
+    Term *terms[3] = { &term1, &term2, &conclusion_term };
+    for(int k=0; k<3; k++)
+    {
+        for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+        {
+            Atom atom = terms[k]->atoms[i];
+            if(NAL_IsMetaVariable(atom) && !unbound[(int) atom])
+            {
+                unbound[(int) atom] = true;
+                printf("substitutions[%d] = (Term) {0};\n", atom);
+            }
+        }
+    }
     for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
     {
         NAL_GeneratePremisesUnifier(i, term1.atoms[i], 1);
@@ -90,8 +110,30 @@ static void NAL_GenerateConclusionTerm(char *premise1, char *premise2, char* con
     }
 }
 
+//Prints a rule as C string literal for the rule names table
+static void NAL_GenerateRuleName(char *premise1, char *premise2, char* conclusion, char* truthFunction)
+{
+    char name[NARSESE_LEN_MAX];
+    snprintf(name, NARSESE_LEN_MAX, premise2 == NULL ? "%s%s |- %s %s" : "%s, %s |- %s %s", premise1, premise2 == NULL ? "" : premise2, conclusion, truthFunction);
+    putchar('"');
+    for(char *c = name; *c; c++)
+    {
+        if(*c == '"' || *c == '\\')
+        {
+            putchar('\\');
+        }
+        putchar(*c);
+    }
+    puts("\",");
+}
+
 static void NAL_GenerateRule(char *premise1, char *premise2, char* conclusion, char* truthFunction, bool doublePremise, bool switchTruthArgs)
 {
+    if(generateRuleNames)
+    {
+        NAL_GenerateRuleName(premise1, premise2, conclusion, truthFunction);
+        return;
+    }
     NAL_GenerateConclusionTerm(premise1, premise2, conclusion, doublePremise);
     if(switchTruthArgs)
     {
@@ -101,7 +143,7 @@ static void NAL_GenerateRule(char *premise1, char *premise2, char* conclusion, c
     {
         printf("Truth conclusionTruth = %s(truth1,truth2);\n", truthFunction);
     }
-    puts("NAL_DerivedEvent(RuleTable_Reduce(conclusion, false), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, validation_concept, validation_cid);}\n");
+    printf("NAL_DerivedEvent(nar, RuleTable_Reduce(conclusion, false), conclusionOccurrence, conclusionTruth, conclusionStamp, currentTime, parentPriority, conceptPriority, validation_concept, validation_cid, %d);}\n\n", ruleID-1);
 }
 
 static void NAL_GenerateReduction(char *premise1, char* conclusion)
@@ -113,7 +155,7 @@ static void NAL_GenerateReduction(char *premise1, char* conclusion)
 void NAL_GenerateRuleTable()
 {
     puts("#include \"RuleTable.h\"");
-    puts("void RuleTable_Apply(Term term1, Term term2, Truth truth1, Truth truth2, long conclusionOccurrence, Stamp conclusionStamp, long currentTime, double parentPriority, double conceptPriority, bool doublePremise, Concept *validation_concept, long validation_cid)\n{\ngoto RULE_0;");
+    puts("void RuleTable_Apply(NAR *nar, Term term1, Term term2, Truth truth1, Truth truth2, long conclusionOccurrence, Stamp conclusionStamp, long currentTime, double parentPriority, double conceptPriority, bool doublePremise, Concept *validation_concept, long validation_cid)\n{\ngoto RULE_0;");
 #define H_NAL_RULES
 #include "NAL.h"
 #undef H_NAL_RULES
@@ -123,9 +165,17 @@ void NAL_GenerateRuleTable()
 #include "NAL.h"
 #undef H_NAL_REDUCTIONS
     printf("RULE_%d:;\nreturn term1;\n}\n\n", ruleID);
+    //names of the rules for tracing, in the order of their IDs
+    puts("char *RuleTable_RuleNames[] = {");
+    generateRuleNames = true;
+#define H_NAL_RULES
+#include "NAL.h"
+#undef H_NAL_RULES
+    generateRuleNames = false;
+    puts("};\nint RuleTable_RulesAmount = sizeof(RuleTable_RuleNames) / sizeof(RuleTable_RuleNames[0]);");
 }
 
-void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conclusionTruth, Stamp stamp, long currentTime, double parentPriority, double conceptPriority, Concept *validation_concept, long validation_cid)
+void NAL_DerivedEvent(NAR *nar, Term conclusionTerm, long conclusionOccurrence, Truth conclusionTruth, Stamp stamp, long currentTime, double parentPriority, double conceptPriority, Concept *validation_concept, long validation_cid, int rule)
 {
     Event e = { .term = conclusionTerm,
                 .type = EVENT_TYPE_BELIEF, 
@@ -133,11 +183,12 @@ void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conc
                 .stamp = stamp,
                 .occurrenceTime = conclusionOccurrence ,
                 .creationTime = currentTime };
-    #pragma omp critical
+    pthread_mutex_lock(&nar->derivationLock); //per instance, so that instances don't wait for each other
+    if(validation_concept == NULL || validation_concept->id == validation_cid) //concept recycling would invalidate the derivation (allows to lock only adding results to memory)
     {
-        if(validation_concept == NULL || validation_concept->id == validation_cid) //concept recycling would invalidate the derivation (allows to lock only adding results to memory)
-        {
-            Memory_addEvent(&e, currentTime, conceptPriority*parentPriority*Truth_Expectation(conclusionTruth), false, true, false, false);
-        }
+        nar->traceRule = rule;
+        Memory_addEvent(nar, &e, currentTime, conceptPriority*parentPriority*Truth_Expectation(conclusionTruth), false, true, false, false);
+        nar->traceRule = TRACE_RULE_SENSORIMOTOR;
     }
+    pthread_mutex_unlock(&nar->derivationLock);
 }
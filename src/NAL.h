@@ -36,13 +36,15 @@
 #include "Stamp.h"
 #include "Narsese.h"
 #include "Memory.h"
+#include "Trace.h"
 
 //Methods//
 //-------//
 //Generates inference rule code
 void NAL_GenerateRuleTable();
 //Method for the derivation of new events as called by the generated rule table
-void NAL_DerivedEvent(Term conclusionTerm, long conclusionOccurrence, Truth conclusionTruth, Stamp stamp, long currentTime, double parentPriority, double conceptPriority, Concept *validation_concept, long validation_cid);
+//rule is the rule table rule ID, or a TRACE_RULE_ origin
+void NAL_DerivedEvent(NAR *nar, Term conclusionTerm, long conclusionOccurrence, Truth conclusionTruth, Stamp stamp, long currentTime, double parentPriority, double conceptPriority, Concept *validation_concept, long validation_cid, int rule);
 //macro for syntactic representation, increases readability, double premise inference
 #define R2(premise1, premise2, _, conclusion, truthFunction) NAL_GenerateRule(#premise1, #premise2, #conclusion, #truthFunction, true,false); NAL_GenerateRule(#premise2, #premise1, #conclusion, #truthFunction, true, true);
 //macro for syntactic representation, increases readability, single premise inference
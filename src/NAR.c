@@ -24,54 +24,88 @@
 
 #include "NAR.h"
 
-long currentTime = 1;
+NAR *NAR_New()
+{
+    NAR *nar = calloc(1, sizeof(NAR)); //the storage is only mapped when used
+    assert(nar != NULL, "Not enough memory for another NAR instance");
+    pthread_mutex_init(&nar->derivationLock, NULL);
+    NAR_INIT(nar);
+    return nar;
+}
+
+void NAR_Free(NAR *nar)
+{
+    assert(!nar->runnerActive, "Stop the runner before freeing the instance");
+    assert(!nar->executorActive, "Stop the executor before freeing the instance");
+    pthread_mutex_destroy(&nar->derivationLock);
+    Memory_Free(nar);
+    free(nar);
+}
 
-void NAR_INIT()
+void NAR_INIT(NAR *nar)
 {
     assert(pow(TRUTH_PROJECTION_DECAY_INITIAL,EVENT_BELIEF_DISTANCE) >= MIN_CONFIDENCE, "Bad params, increase projection decay or decrease event belief distance!");
-    Memory_INIT(); //clear data structures
-    Event_INIT(); //reset base id counter
-    Narsese_INIT();
-    currentTime = 1; //reset time
+    Memory_INIT(nar); //clear data structures
+    nar->base = 1; //reset base id counters
+    nar->stampID = -1;
+    Random_Seed(&nar->random, NAR_RANDOM_SEED);
+    nar->currentTime = 1; //reset time
 }
 
-void NAR_Cycles(int cycles)
+void NAR_Cycles(NAR *nar, int cycles)
 {
     for(int i=0; i<cycles; i++)
     {
+        //once there is nothing left to process, the remaining cycles only forget
+        if(CYCLE_FAST_FORWARD && Cycle_Idle(nar))
+        {
+            Cycle_FastForward(nar, nar->currentTime, cycles - i);
+            nar->currentTime += cycles - i;
+            break;
+        }
         IN_DEBUG( puts("\nNew system cycle:\n----------"); )
-        Cycle_Perform(currentTime);
-        currentTime++;
+        Cycle_Perform(nar, nar->currentTime);
+        nar->currentTime++;
     }
 }
 
-Event NAR_AddInput(Term term, char type, Truth truth, bool eternal)
+Event NAR_AddInput(NAR *nar, Term term, char type, Truth truth, bool eternal)
 {
-    Event ev = Event_InputEvent(term, type, truth, currentTime);
+    //a cycle processes the newest input event, so pending operator feedback gets its cycle first
+    if(__atomic_load_n(&nar->feedbackPending, __ATOMIC_ACQUIRE) > 0)
+    {
+        NAR_Cycles(nar, 1);
+    }
+    Event ev = Event_InputEvent(term, type, truth, nar->currentTime, nar->base++);
     if(eternal)
     {
         ev.occurrenceTime = OCCURRENCE_ETERNAL;
     }
-    Memory_addInputEvent(&ev, currentTime);
-    NAR_Cycles(1);
+    Memory_addInputEvent(nar, &ev, nar->currentTime);
+    NAR_Cycles(nar, 1);
     return ev;
 }
 
-Event NAR_AddInputBelief(Term term)
+Event NAR_AddInputBelief(NAR *nar, Term term)
 {
-    Event ret = NAR_AddInput(term, EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false);
+    Event ret = NAR_AddInput(nar, term, EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false);
     return ret;
 }
 
-Event NAR_AddInputGoal(Term term)
+Event NAR_AddInputGoal(NAR *nar, Term term)
 {
-    return NAR_AddInput(term, EVENT_TYPE_GOAL, NAR_DEFAULT_TRUTH, false);
+    return NAR_AddInput(nar, term, EVENT_TYPE_GOAL, NAR_DEFAULT_TRUTH, false);
 }
 
-void NAR_AddOperation(Term term, Action procedure)
+bool NAR_QueueInput(NAR *nar, Term term, char type, Truth truth, bool eternal)
+{
+    Event ev = { .term = term, .type = type, .truth = truth, .occurrenceTime = eternal ? OCCURRENCE_ETERNAL : 0 };
+    return EventQueue_Push(&nar->inputs, &ev);
+}
+
+void NAR_AddOperation(NAR *nar, Term term, Action procedure)
 {
     char* term_name = Narsese_atomNames[(int) term.atoms[0]-1];
     assert(term_name[0] == '^', "This atom does not belong to an operator!");
-    Memory_addOperation(Narsese_OperatorIndex(term_name), (Operation) {.term = term, .action = procedure});
+    Memory_addOperation(nar, Narsese_OperatorIndex(term_name), (Operation) {.term = term, .action = procedure});
 }
-
@@ -36,24 +36,32 @@
 
 //Parameters//
 //----------//
-#define NAR_DEFAULT_TRUTH ((Truth) { .frequency = NAR_DEFAULT_FREQUENCY, .confidence = NAR_DEFAULT_CONFIDENCE })
-extern long currentTime;
+#define NAR_DEFAULT_TRUTH Truth_New(NAR_DEFAULT_FREQUENCY, NAR_DEFAULT_CONFIDENCE)
+#define NAR_RANDOM_SEED 1337
 
 //Callback function types//
 //-----------------------//
-//typedef void (*Action)(void);     //already defined in Memory
+//typedef void (*Action)(NAR *nar, Term args);     //already defined in Memory
 
 //Methods//
 //-------//
+//Instances are independent of each other, each can be driven by its own thread.
+//They share the atom table, which Narsese_INIT resets, and the parameters.
+//Create an initialized instance
+NAR *NAR_New();
+//Free an instance created by NAR_New
+void NAR_Free(NAR *nar);
 //Init/Reset system
-void NAR_INIT();
+void NAR_INIT(NAR *nar);
 //Run the system for a certain amount of cycles
-void NAR_Cycles(int cycles);
+void NAR_Cycles(NAR *nar, int cycles);
 //Add input
-Event NAR_AddInput(Term term, char type, Truth truth, bool eternal);
-Event NAR_AddInputBelief(Term term);
-Event NAR_AddInputGoal(Term term);
+Event NAR_AddInput(NAR *nar, Term term, char type, Truth truth, bool eternal);
+Event NAR_AddInputBelief(NAR *nar, Term term);
+Event NAR_AddInputGoal(NAR *nar, Term term);
+//Queue input from any thread, it's added at the start of the next cycle, returns false if the queue is full
+bool NAR_QueueInput(NAR *nar, Term term, char type, Truth truth, bool eternal);
 //Add an operation
-void NAR_AddOperation(Term term, Action procedure);
+void NAR_AddOperation(NAR *nar, Term term, Action procedure);
 
 #endif
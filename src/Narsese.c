@@ -25,375 +25,334 @@
 #include "Narsese.h"
 #include "NAR.h"
 
-//upper bound of multplier 3 given by [ becoming "(' " replacement
-#define REPLACEMENT_LEN 3*NARSESE_LEN_MAX
-//size for the expanded array with spaces for tokenization, has at most 3 times the amount of chars as the replacement array
-#define EXPANSION_LEN REPLACEMENT_LEN*3
-
-//Replace copulas with canonical single-char copulas, including sets and set elements!
-char* replaceWithCanonicalCopulas(char *narsese, int n)
-{
-    static char narsese_replaced[REPLACEMENT_LEN]; 
-    memset(narsese_replaced, ' ', REPLACEMENT_LEN);
-    //upper bound of 3 increment given by max. look-ahead of --> becoming :, plus 0 at the end
-    assert(n+3 <= NARSESE_LEN_MAX, "NARSESE_LEN_MAX too small, consider increasing or split input into multiple statements! \n");
-    int j=0;
-    for(int i=0; i<n; )
-    {
-        if(narsese[i] == ',') //, becomes " "
-        {
-            narsese_replaced[j] = ' '; 
-            i++; j++;
-        }
-        else
-        if(narsese[i] == '[') // [ becomes "(' "
-        {
-            narsese_replaced[j] = '('; 
-            narsese_replaced[j+1] = '\''; 
-            narsese_replaced[j+2] = ' '; 
-            i++; j+=3;
-        }
-        else
-        if(narsese[i] == '{') // { becomes '(" '
-        {
-            narsese_replaced[j] = '('; 
-            narsese_replaced[j+1] = '"'; 
-            narsese_replaced[j+2] = ' '; 
-            i++; j+=3;
-        }
-        else
-        if(narsese[i] == '}' || narsese[i] == ']' || narsese[i] == '>') // }, ], > becomes )
-        {
-            narsese_replaced[j] = ')';
-            i++; j++; 
-        }
-        else
-        if(narsese[i] == '<' && narsese[i+1] != '-') // < becomes (
-        {
-            narsese_replaced[j] = '(';
-            i++; j++; 
-        }
-        else
-        if(i+1 < n)
-        {
-            if(narsese[i] == '&' && narsese[i+1] == '/') // &/ becomes +
-            {
-                narsese_replaced[j] = '+';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '&' && narsese[i+1] == '|') // &| becomes ;
-            {
-                narsese_replaced[j] = ';';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '&' && narsese[i+1] == '&') // && becomes ;
-            {
-                narsese_replaced[j] = ';';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '/' && narsese[i+1] == '1') // /1 becomes /
-            {
-                narsese_replaced[j] = '/';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '/' && narsese[i+1] == '2') // /2 becomes %
-            {
-                narsese_replaced[j] = '%';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '\\' && narsese[i+1] == '1') // \1 becomes backslash
-            {
-                narsese_replaced[j] = '\\';
-                i+=2; j++;
-            }
-            else
-            if(narsese[i] == '\\' && narsese[i+1] == '2') // \2 becomes #
-            {
-                narsese_replaced[j] = '#';
-                i+=2; j++;
-            }
-            else
-            if(i+2 < n)
-            {
-                if(narsese[i] == '-' && narsese[i+1] == '-' && narsese[i+2] == '>') // --> becomes :
-                {
-                    narsese_replaced[j] = ':';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '<' && narsese[i+1] == '-' && narsese[i+2] == '>') // -<-> becomes :
-                {
-                    narsese_replaced[j] = '=';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '=' && narsese[i+1] == '/' && narsese[i+2] == '>') // =/> becomes $
-                {
-                    narsese_replaced[j] = '$';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '=' && narsese[i+1] == '=' && narsese[i+2] == '>') // ==> becomes $
-                {
-                    narsese_replaced[j] = '$';
-                    i+=3; j++;
-                }
-                else
-                if(narsese[i] == '-' && narsese[i+1] == '-' && narsese[i+2] != '>') // -- becomes !
-                {
-                    narsese_replaced[j] = '!';
-                    i+=3; j++;
-                }
-                else
-                {
-                    goto DEFAULT;
-                }
-            }
-            else
-            {
-                goto DEFAULT;
-            }
-        }
-        else
-        {
-            goto DEFAULT;
-        }
-        continue;
-        DEFAULT:
-        narsese_replaced[j] = narsese[i]; //default
-        i++; j++;
-    }
-    narsese_replaced[j] = 0;
-    return narsese_replaced;
+static char* canonical_copulas = "@*&|;:=$'\"/\\.-%#~+!";
+//Multi-char copulas and their canonical single-char copulas, including sets and set elements:
+static char* copula_spellings[][2] = { {"-->", ":"}, {"<->", "="}, {"=/>", "$"}, {"==>", "$"}, {"&/", "+"}, {"&|", ";"}, {"&&", ";"}, 
+                                       {"/1", "/"}, {"/2", "%"}, {"\\1", "\\"}, {"\\2", "#"}, {"--", "!"} };
+#define COPULA_SPELLINGS (sizeof(copula_spellings) / sizeof(copula_spellings[0]))
+
+int operator_index = 0;
+static int operatorIndexOfAtom[TERMS_MAX+1]; //index of the operator, 0 if the atom isn't one
+int Narsese_OperatorIndex(char *name)
+{
+    assert(name[0] == '^', "This atom does not belong to an operator!");
+    return operatorIndexOfAtom[Narsese_AtomicTermIndex(name)];
 }
 
-char* Narsese_Expand(char *narsese)
+//Open addressing index of the atom names, TERMS_MAX_HASHED > TERMS_MAX so that probing always terminates
+#define TERMS_MAX_HASHED (TERMS_MAX*2)
+static int atomIndexByHash[TERMS_MAX_HASHED]; //index+1 of the atom in Narsese_atomNames, 0 if free
+int term_index = 0;
+
+static unsigned int Narsese_NameHash(const char *name, int len)
 {
-    //upper bound being 3* the multiplier of the previous upper bound
-    static char narsese_expanded[EXPANSION_LEN]; 
-    memset(narsese_expanded, ' ', EXPANSION_LEN);
-    char *narsese_replaced = replaceWithCanonicalCopulas(narsese, strlen(narsese));
-    int k = 0, n = strlen(narsese_replaced);
-    for(int i=0; i<n; i++)
+    unsigned int hash = 2166136261u; //FNV-1a
+    for(int i=0; i<len; i++)
     {
-        bool opener_closer = false;
-        if(narsese_replaced[i] == '(' || narsese_replaced[i] == ')')
-        {
-            k+=1;
-            opener_closer = true;
-        }
-        narsese_expanded[k] = narsese_replaced[i];
-        if(narsese_replaced[i] == 0)
-        {
-            break;
-        }
-        if(opener_closer)
-        {
-            k+=1;
-        }
-        k+=1;
+        hash = (hash ^ (unsigned char) name[i]) * 16777619u;
     }
-    narsese_expanded[k] = 0;
-    return narsese_expanded;
+    return hash;
 }
 
-//skips one compound term by counting parenthesis (1 for "(", -1 for ")") till counter becomes zero again, returning the component index right after it
-int skipCompound(char** tokens, int i, int nt)
+static bool Narsese_NameEquals(int index, const char *name, int len)
 {
-    int parenthesis_cnt = 0; //incremented for each (, decremented for each ), count will be zero after the compound again
-    for(; i<nt; i++)
-    {
-        if(tokens[i][0] == '(' && tokens[i][1] == 0)
-        {
-            parenthesis_cnt += 1;
-        }
-        if(tokens[i][0] == ')' && tokens[i][1] == 0)
-        {
-            parenthesis_cnt -= 1;
-        }
-        if(parenthesis_cnt==0)
-        {
-            return i+1;
-        }
-    }
-    return i;
+    return !strncmp(Narsese_atomNames[index-1], name, len) && Narsese_atomNames[index-1][len] == 0;
 }
 
-static char* canonical_copulas = "@*&|;:=$'\"/\\.-%#~+!";
-char** Narsese_PrefixTransform(char* narsese_expanded)
+//Returns the memoized index of an already seen atomic term given by name and its length, registering it if new, 0 on failure
+static int Narsese_AtomicTermIndexOfToken(const char *name, int len)
 {
-    static char* tokens[NARSESE_LEN_MAX+1]; //there cannot be more tokens than chars
-    memset(tokens, 0, (NARSESE_LEN_MAX+1)*sizeof(char*)); //and last one stays NULL for sure
-    char* token = strtok(narsese_expanded, " ");
-    int nt=0, nc = strlen(canonical_copulas);
-    while(token)
+    if(len <= 0 || len >= ATOMIC_TERM_LEN_MAX)
+    {
+        return 0;
+    }
+    unsigned int slot = Narsese_NameHash(name, len) % TERMS_MAX_HASHED;
+    //lock-free lookup, entries are only published after the name was written
+    for(int index; (index = __atomic_load_n(&atomIndexByHash[slot], __ATOMIC_ACQUIRE)) != 0; slot = (slot+1) % TERMS_MAX_HASHED)
     {
-        tokens[nt] = token;
-        token = strtok(NULL, " ");
-        nt++;
+        if(Narsese_NameEquals(index, name, len))
+        {
+            return index;
+        }
     }
-    for(int i=0; i<nt-2; i++)
+    int ret_index = 0;
+    #pragma omp critical(Narsese_AtomRegistration)
     {
-        if(tokens[i][0] == '(' && tokens[i][1] == 0)   //see if it's in prefix form
+        //another thread might have registered it in the meantime, so continue probing from where the lookup ended
+        int index;
+        for(; (index = atomIndexByHash[slot]) != 0; slot = (slot+1) % TERMS_MAX_HASHED)
         {
-            for(int k=0; k<nc; k++)
+            if(Narsese_NameEquals(index, name, len))
             {
-                if(tokens[i+1][0]==(int)canonical_copulas[k] && tokens[i+1][1] == 0)
-                {
-                    goto Continue;
-                }
+                ret_index = index;
+                break;
             }
-            //it's not a copula, so its in infix form, we need to find its copula and put it before tokens[i+1]
-            int i2 = skipCompound(tokens, i+1, nt);
-            if(i2 < nt)
+        }
+        if(index == 0 && term_index < TERMS_MAX)
+        {
+            memcpy(Narsese_atomNames[term_index], name, len);
+            Narsese_atomNames[term_index][len] = 0;
+            if(name[0] == '^')
             {
-                //1. backup copula token
-                char copula = tokens[i2][0];
-                //2. shift all tokens forward up to copula position and set the copula to be at i+1 instead
-                for(int j=i2; j>=i+2; j--)
-                {
-                    char *temp = tokens[j];
-                    tokens[j] = tokens[j-1];
-                    tokens[j-1] = temp;
-                }
-                tokens[i+1][0] = copula;
-                tokens[i+1][1] = 0;
+                assert(operator_index < OPERATIONS_MAX, "Too many operators, increase OPERATIONS_MAX!");
+                operatorIndexOfAtom[term_index+1] = ++operator_index;
             }
+            term_index++;
+            ret_index = term_index;
+            __atomic_store_n(&atomIndexByHash[slot], ret_index, __ATOMIC_RELEASE);
         }
-        Continue:;
     }
-    return tokens;
+    return ret_index;
 }
 
-int operator_index = 0;
-int Narsese_OperatorIndex(char *name)
+int Narsese_AtomicTermIndex(char *name)
+{
+    int ret_index = Narsese_AtomicTermIndexOfToken(name, strlen(name));
+    assert(ret_index != 0, "Too many terms for NAR, or atomic term name too long");
+    return ret_index;
+}
+
+//Single-pass parser state, the input is tokenized in place without copying it
+typedef struct
+{
+    char *cur; //current read position
+    char *end; //end of the region to parse (exclusive)
+    char *token; //start of the current token
+    int tokenLen; //length of the current token
+    char impliedCopula; //copula implied by an opener, ' for [ and " for {
+} Narsese_Parser;
+
+#define TOKEN_END 0
+#define TOKEN_OPEN 1
+#define TOKEN_CLOSE 2
+#define TOKEN_ATOM 3
+
+static bool Narsese_IsDelimiter(char c)
+{
+    return c == ' ' || c == '\t' || c == ',' || c == '(' || c == ')' || c == '[' || c == ']' || c == '{' || c == '}' || c == '<' || c == '>';
+}
+
+static bool Narsese_StartsWith(Narsese_Parser *p, char *s, int len)
 {
-    int ret_index = -1;
-    for(int i=0; i<operator_index; i++)
+    return p->end - p->cur >= len && !strncmp(p->cur, s, len);
+}
+
+static int Narsese_NextToken(Narsese_Parser *p)
+{
+    while(p->cur < p->end && (*p->cur == ' ' || *p->cur == '\t' || *p->cur == ','))
     {
-        if(!strcmp(Narsese_operatorNames[i], name))
-        {
-            ret_index = i+1;
-            break;
-        }
+        p->cur++;
     }
-    if(ret_index == -1)
+    p->token = p->cur;
+    p->tokenLen = 0;
+    p->impliedCopula = 0;
+    if(p->cur >= p->end)
     {
-        assert(operator_index < OPERATIONS_MAX, "Too many operators, increase OPERATIONS_MAX!");
-        ret_index = operator_index+1;
-        strncpy(Narsese_operatorNames[operator_index], name, ATOMIC_TERM_LEN_MAX);
-        operator_index++;
+        return TOKEN_END;
     }
-    return ret_index;
+    char c = *p->cur;
+    if(Narsese_StartsWith(p, "<->", 3) || Narsese_StartsWith(p, "-->", 3) || Narsese_StartsWith(p, "=/>", 3) || Narsese_StartsWith(p, "==>", 3))
+    {
+        p->tokenLen = 3;
+        p->cur += 3;
+        return TOKEN_ATOM;
+    }
+    if(c == '(' || c == '<' || c == '[' || c == '{')
+    {
+        p->impliedCopula = c == '[' ? '\'' : (c == '{' ? '"' : 0);
+        p->cur++;
+        return TOKEN_OPEN;
+    }
+    if(c == ')' || c == '>' || c == ']' || c == '}')
+    {
+        p->cur++;
+        return TOKEN_CLOSE;
+    }
+    while(p->cur < p->end && !Narsese_IsDelimiter(*p->cur))
+    {
+        p->cur++;
+    }
+    p->tokenLen = p->cur - p->token;
+    return TOKEN_ATOM;
 }
 
-int term_index = 0;
-//Returns the memoized index of an already seen atomic term
-int Narsese_AtomicTermIndex(char *name)
+//The canonical copula of the current token, 0 if it's not a copula
+static char Narsese_TokenCopula(Narsese_Parser *p, bool lenient)
 {
-    int ret_index = -1;
-    for(int i=0; i<term_index; i++)
+    for(unsigned int i=0; i<COPULA_SPELLINGS; i++)
     {
-        if(!strcmp(Narsese_atomNames[i], name))
+        if((int) strlen(copula_spellings[i][0]) == p->tokenLen && !strncmp(copula_spellings[i][0], p->token, p->tokenLen))
         {
-            ret_index = i+1;
-            break;
+            return copula_spellings[i][1][0];
         }
     }
-    if(name[0] == '^')
+    //in infix position the first char decides, which also allows for stringified spellings like \\1
+    if((p->tokenLen == 1 || lenient) && strchr(canonical_copulas, p->token[0]) != NULL)
+    {
+        return p->token[0];
+    }
+    return 0;
+}
+
+static bool Narsese_SetAtom(Term *term, int tree_index, const char *name, int len)
+{
+    if(tree_index-1 >= COMPOUND_TERM_SIZE_MAX)
     {
-        Narsese_OperatorIndex(name);
+        return false; //COMPOUND_TERM_SIZE_MAX too small
     }
-    if(ret_index == -1)
+    int index = Narsese_AtomicTermIndexOfToken(name, len);
+    term->atoms[tree_index-1] = index;
+    return index != 0;
+}
+
+//Skips the remaining elements of a compound till its closer, as only two elements are encoded
+static bool Narsese_SkipToCloser(Narsese_Parser *p)
+{
+    for(int depth=0;;)
     {
-        assert(term_index < TERMS_MAX, "Too many terms for NAR");
-        ret_index = term_index+1;
-        strncpy(Narsese_atomNames[term_index], name, ATOMIC_TERM_LEN_MAX);
-        term_index++;
+        int kind = Narsese_NextToken(p);
+        if(kind == TOKEN_END)
+        {
+            return false;
+        }
+        if(kind == TOKEN_OPEN)
+        {
+            depth++;
+        }
+        if(kind == TOKEN_CLOSE && depth-- == 0)
+        {
+            return true;
+        }
     }
-    return ret_index;
 }
 
-//Encodes a binary tree in an array, based on the the S-expression tokenization with prefix order
-void buildBinaryTree(Term *bintree, char** tokens_prefix, int i1, int tree_index, int nt)
+//Encodes a binary tree in an array, directly while tokenizing, with the copula at tree_index and the elements as its children
+static bool Narsese_ParseTermAt(Narsese_Parser *p, Term *term, int tree_index, int kind);
+static bool Narsese_ParseCompound(Narsese_Parser *p, Term *term, int tree_index)
 {
-    if(tokens_prefix[i1][0] == '(' && tokens_prefix[i1][1] == 0)
+    char copula = p->impliedCopula;
+    bool isSet = copula != 0;
+    int kind = Narsese_NextToken(p);
+    if(!isSet && kind == TOKEN_ATOM)
     {
-        int icop = i1+1;
-        //first argument is given by the copula
-        i1 = i1+2;
-        //second argument has to be searched for
-        int i2 = skipCompound(tokens_prefix, i1, nt);
-        bintree->atoms[tree_index-1] = Narsese_AtomicTermIndex(tokens_prefix[icop]);
-        if(i1<nt)
+        copula = Narsese_TokenCopula(p, false);
+    }
+    if(copula)
+    {
+        //prefix form, the copula is given by the set opener or the first token
+        if(!isSet)
         {
-            buildBinaryTree(bintree, tokens_prefix, i1, tree_index*2, nt); //left child of tree index
+            kind = Narsese_NextToken(p);
         }
-        if(i2<nt)
+        if(!Narsese_ParseTermAt(p, term, tree_index*2, kind))
         {
-            buildBinaryTree(bintree, tokens_prefix, i2, tree_index*2+1, nt); //right child of tree index
+            return false;
         }
     }
     else
     {
-        assert(tree_index-1 < COMPOUND_TERM_SIZE_MAX, "COMPOUND_TERM_SIZE_MAX too small, consider increasing or split input into multiple statements!");
-        if(!(tokens_prefix[i1][0] == ')' && tokens_prefix[i1][1] == 0))
+        //infix form, the copula follows the first element
+        if(!Narsese_ParseTermAt(p, term, tree_index*2, kind) || Narsese_NextToken(p) != TOKEN_ATOM || !(copula = Narsese_TokenCopula(p, true)))
         {
-            bintree->atoms[tree_index-1] = Narsese_AtomicTermIndex(tokens_prefix[i1]);
+            return false;
         }
-        else
+    }
+    char copula_name[2] = { copula, 0 };
+    if(!Narsese_SetAtom(term, tree_index, copula_name, 1))
+    {
+        return false;
+    }
+    kind = Narsese_NextToken(p);
+    if(kind == TOKEN_CLOSE)
+    {
+        //just use "@" for second element as terminator, while "." acts for "deeper" sets than 2
+        return Narsese_SetAtom(term, tree_index*2+1, "@", 1);
+    }
+    return Narsese_ParseTermAt(p, term, tree_index*2+1, kind) && Narsese_SkipToCloser(p);
+}
+
+static bool Narsese_ParseTermAt(Narsese_Parser *p, Term *term, int tree_index, int kind)
+{
+    if(kind == TOKEN_OPEN)
+    {
+        return tree_index-1 < COMPOUND_TERM_SIZE_MAX && Narsese_ParseCompound(p, term, tree_index);
+    }
+    if(kind == TOKEN_ATOM)
+    {
+        char copula = Narsese_TokenCopula(p, false);
+        if(copula && p->tokenLen > 1)
         {
-            bintree->atoms[tree_index-1] = Narsese_AtomicTermIndex("@"); //just use "@" for second element as terminator, while "." acts for "deeper" sets than 2
+            char copula_name[2] = { copula, 0 };
+            return Narsese_SetAtom(term, tree_index, copula_name, 1);
         }
+        return Narsese_SetAtom(term, tree_index, p->token, p->tokenLen);
     }
+    return false; //unexpected closer or end
+}
+
+static bool Narsese_ParseTermRegion(char *narsese, char *end, Term *destTerm)
+{
+    Narsese_Parser p = { .cur = narsese, .end = end };
+    *destTerm = (Term) {0};
+    return Narsese_ParseTermAt(&p, destTerm, 1, Narsese_NextToken(&p)) && Narsese_NextToken(&p) == TOKEN_END;
+}
+
+bool Narsese_ParseTerm(char *narsese, Term *destTerm)
+{
+    return Narsese_ParseTermRegion(narsese, narsese + strlen(narsese), destTerm);
 }
 
 Term Narsese_Term(char *narsese)
 {
-    Term ret = {0};
-    char *narsese_expanded = Narsese_Expand(narsese);
-    char** tokens_prefix = Narsese_PrefixTransform(narsese_expanded);
-    int nt = 0; for(;tokens_prefix[nt] != NULL; nt++){}
-    buildBinaryTree(&ret, tokens_prefix, 0, 1, nt);
+    Term ret;
+    assert(Narsese_ParseTerm(narsese, &ret), "Parsing error: Narsese term is malformed!");
     return ret;
 }
 
-void Narsese_Sentence(char *narsese, Term *destTerm, char *punctuation, bool *isEvent, Truth *destTv)
+bool Narsese_Sentence(char *narsese, Term *destTerm, char *punctuation, bool *isEvent, Truth *destTv)
 {
-    char narseseInplace[NARSESE_LEN_MAX] = {0};
-    destTv->frequency = NAR_DEFAULT_FREQUENCY;
-    destTv->confidence = NAR_DEFAULT_CONFIDENCE;
-    int len = strlen(narsese);
-    assert(len > 1, "Parsing error: Narsese string too short!");
-    assert(len < NARSESE_LEN_MAX, "Parsing error: Narsese string too long!"); //< because of '0' terminated strings
-    memcpy(narseseInplace, narsese, len);
+    *destTv = NAR_DEFAULT_TRUTH;
+    char *end = narsese + strlen(narsese);
+    while(end > narsese && (end[-1] == ' ' || end[-1] == '\t'))
+    {
+        end--;
+    }
+    if(end - narsese < 2 || end - narsese >= NARSESE_LEN_MAX)
+    {
+        return false; //Narsese string too short or too long
+    }
     //tv is present if last letter is '}'
-    if(len>=2 && narseseInplace[len-1] == '}')
+    if(end[-1] == '}')
     {
         //scan for opening '{'
-        int openingIdx;
-        for(openingIdx=len-2; openingIdx>=0 && narseseInplace[openingIdx] != '{'; openingIdx--);
-        assert(narseseInplace[openingIdx] == '{', "Parsing error: Truth value opener not found!");
-        double conf, freq;
-        sscanf(&narseseInplace[openingIdx], "{%lf %lf}", &freq, &conf);
-        destTv->frequency = freq;
-        destTv->confidence = conf;
-        assert(narseseInplace[openingIdx-1] == ' ', "Parsing error: Space before truth value required!");
-        narseseInplace[openingIdx-1] = 0; //cut it away for further parsing of term
+        char *opener = end-2;
+        for(; opener >= narsese && *opener != '{'; opener--);
+        double freq, conf;
+        if(opener <= narsese || opener[-1] != ' ' || sscanf(opener, "{%lf %lf}", &freq, &conf) != 2 ||
+           freq < 0.0 || freq > 1.0 || conf < 0.0 || conf > 1.0)
+        {
+            return false; //truth value opener not found, no space before it, or invalid truth value
+        }
+        *destTv = Truth_New(freq, conf);
+        for(end = opener; end > narsese && end[-1] == ' '; end--);
     }
     //parse event marker, punctuation, and finally the term:
-    int str_len = strlen(narseseInplace);
-    *isEvent = str_len >= 3 && narseseInplace[str_len-1] == ':' && narseseInplace[str_len-2] == '|' && narseseInplace[str_len-3] == ':'; 
-    int punctuation_offset = *isEvent ? 5 : 1;
-    *punctuation = narseseInplace[str_len-punctuation_offset];
-    assert(*punctuation == '!' || *punctuation == '?' || *punctuation == '.', "Parsing error: Punctuation has to be belief . goal ! or question ?");
-    narseseInplace[str_len-punctuation_offset] = 0; //we will only parse the term before it
-    *destTerm = Narsese_Term(narseseInplace);
+    *isEvent = end - narsese >= 3 && !strncmp(end-3, ":|:", 3);
+    if(*isEvent)
+    {
+        for(end -= 3; end > narsese && end[-1] == ' '; end--);
+    }
+    if(end == narsese)
+    {
+        return false;
+    }
+    *punctuation = end[-1];
+    if(*punctuation != '!' && *punctuation != '?' && *punctuation != '.')
+    {
+        return false; //punctuation has to be belief . goal ! or question ?
+    }
+    //we will only parse the term before it
+    return Narsese_ParseTermRegion(narsese, end-1, destTerm);
 }
 
 Term Narsese_Sequence(Term *a, Term *b)
@@ -413,66 +372,76 @@ Term Narsese_AtomicTerm(char *name)
     return ret;
 }
 
-void Narsese_PrintAtom(Atom atom)
+//Appends the string, truncating at the destination size
+static void Narsese_Append(char *dest, int *len, int size, char *str)
+{
+    for(; *str && *len < size-1; str++)
+    {
+        dest[(*len)++] = *str;
+    }
+    dest[*len] = 0;
+}
+
+static void Narsese_SprintAtom(Atom atom, char *dest, int *len, int size)
 {
     if(atom)
     {
         if(Narsese_copulaEquals(atom, ':'))
         {
-            fputs("-->", stdout);
+            Narsese_Append(dest, len, size, "-->");
         }
         else
         if(Narsese_copulaEquals(atom, '$'))
         {
-            fputs("=/>", stdout);
+            Narsese_Append(dest, len, size, "=/>");
         }
         else
         if(Narsese_copulaEquals(atom, '+'))
         {
-            fputs("&/", stdout);
+            Narsese_Append(dest, len, size, "&/");
         }
         else
         if(Narsese_copulaEquals(atom, ';'))
         {
-            fputs("&|", stdout);
+            Narsese_Append(dest, len, size, "&|");
         }
         else
         if(Narsese_copulaEquals(atom, '='))
         {
-            fputs("<->", stdout);
+            Narsese_Append(dest, len, size, "<->");
         }
         else
         if(Narsese_copulaEquals(atom, '/'))
         {
-            fputs("/1", stdout);
+            Narsese_Append(dest, len, size, "/1");
         }
         else
         if(Narsese_copulaEquals(atom, '%'))
         {
-            fputs("/2", stdout);
+            Narsese_Append(dest, len, size, "/2");
         }
         else
         if(Narsese_copulaEquals(atom, '\\'))
         {
-            fputs("\\1", stdout);
+            Narsese_Append(dest, len, size, "\\1");
         }
         else
         if(Narsese_copulaEquals(atom, '#'))
         {
-            fputs("\\2", stdout);
+            Narsese_Append(dest, len, size, "\\2");
         }
         else
         {
-            fputs(Narsese_atomNames[atom-1], stdout);
+            Narsese_Append(dest, len, size, Narsese_atomNames[atom-1]);
         }
     }
     else
     {
-        fputs("@", stdout);
+        Narsese_Append(dest, len, size, "@");
     }
 }
 
-void Narsese_PrintTermPrettyRecursive(Term *term, int index) //start with index=1!
+static void Narsese_SprintTermRecursive(Term *term, int index, char *dest, int *len, int size) //start with index=1!
 {
     Atom atom = term->atoms[index-1];
     if(!atom)
@@ -489,84 +458,100 @@ void Narsese_PrintTermPrettyRecursive(Term *term, int index) //start with index=
     bool isStatement = Narsese_copulaEquals(atom, '$') || Narsese_copulaEquals(atom, ':') || Narsese_copulaEquals(atom, '=');
     if(isExtSet)
     {
-        fputs(hasLeftChild ? "{" : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? "{" : "");
     }
     else
     if(isIntSet)
     {
-        fputs(hasLeftChild ? "[" : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? "[" : "");
     }
     else
     if(isStatement)
     {
-        fputs(hasLeftChild ? "<" : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? "<" : "");
     }
     else
     {
-        fputs(hasLeftChild ? "(" : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? "(" : "");
         if(isNegation)
         {
-            Narsese_PrintAtom(atom);
-            fputs(" ", stdout);
+            Narsese_SprintAtom(atom, dest, len, size);
+            Narsese_Append(dest, len, size, " ");
         }
     }
     if(child1 < COMPOUND_TERM_SIZE_MAX)
     {
-        Narsese_PrintTermPrettyRecursive(term, child1);
+        Narsese_SprintTermRecursive(term, child1, dest, len, size);
     }
     if(hasRightChild)
     {
-        fputs(hasLeftChild ? " " : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? " " : "");
     }
     if(!isExtSet && !isIntSet && !Narsese_copulaEquals(atom, '@'))
     {
         if(!isNegation)
         {
-            Narsese_PrintAtom(atom);
-            fputs(hasLeftChild ? " " : "", stdout);
+            Narsese_SprintAtom(atom, dest, len, size);
+            Narsese_Append(dest, len, size, hasLeftChild ? " " : "");
         }
     }
     if(child2 < COMPOUND_TERM_SIZE_MAX)
     {
-        Narsese_PrintTermPrettyRecursive(term, child2);
+        Narsese_SprintTermRecursive(term, child2, dest, len, size);
     }
     if(isExtSet)
     {
-        fputs(hasLeftChild ? "}" : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? "}" : "");
     }
     else
     if(isIntSet)
     {
-        fputs(hasLeftChild ? "]" : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? "]" : "");
     }
     else
     if(isStatement)
     {
-        fputs(hasLeftChild ? ">" : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? ">" : "");
     }
     else
     {
-        fputs(hasLeftChild ? ")" : "", stdout);
+        Narsese_Append(dest, len, size, hasLeftChild ? ")" : "");
     }
 }
 
+int Narsese_SprintTerm(Term *term, char *dest, int size)
+{
+    int len = 0;
+    dest[0] = 0;
+    Narsese_SprintTermRecursive(term, 1, dest, &len, size);
+    return len;
+}
+
+void Narsese_PrintAtom(Atom atom)
+{
+    char printed[ATOMIC_TERM_LEN_MAX] = {0};
+    int len = 0;
+    Narsese_SprintAtom(atom, printed, &len, ATOMIC_TERM_LEN_MAX);
+    Output_Puts(printed);
+}
+
 void Narsese_PrintTerm(Term *term)
 {
-    Narsese_PrintTermPrettyRecursive(term, 1);
+    char printed[NARSESE_PRINTED_LEN_MAX];
+    Narsese_SprintTerm(term, printed, NARSESE_PRINTED_LEN_MAX);
+    Output_Puts(printed);
 }
 
 Atom SELF; //avoids strcmp for checking operator format
 void Narsese_INIT()
 {
     operator_index = term_index = 0;
+    memset(atomIndexByHash, 0, sizeof(atomIndexByHash));
+    memset(operatorIndexOfAtom, 0, sizeof(operatorIndexOfAtom));
     for(int i=0; i<TERMS_MAX; i++)
     {
         memset(&Narsese_atomNames[i], 0, ATOMIC_TERM_LEN_MAX);
     }
-    for(int i=0; i<OPERATIONS_MAX; i++)
-    {
-        memset(&Narsese_operatorNames[i], 0, ATOMIC_TERM_LEN_MAX);
-    }
     //index the copulas at first, to make sure these will have same index on next run
     for(int i=0; i<(int) strlen(canonical_copulas); i++)
     {
@@ -579,14 +564,17 @@ void Narsese_INIT()
     Narsese_AtomicTermIndex("#1");
 }
 
+//Atom 0 is the padding of terms and has no name
 bool Narsese_copulaEquals(Atom atom, char name)
 {
-    return Narsese_atomNames[(int) atom-1][0] == name && Narsese_atomNames[(int) atom-1][1] == 0;
+    int index = (uint8_t) atom;
+    return index > 0 && Narsese_atomNames[index-1][0] == name && Narsese_atomNames[index-1][1] == 0;
 }
 
 bool Narsese_isOperator(Atom atom)
 {
-    return Narsese_atomNames[(int) atom-1][0] == '^';
+    int index = (uint8_t) atom;
+    return index > 0 && Narsese_atomNames[index-1][0] == '^';
 }
 
 bool Narsese_isOperation(Term *term) //<(*,{SELF},x) --> ^op> -> [: * ^op " x _ _ SELF] or simply ^op
@@ -607,11 +595,11 @@ int Narsese_getOperationID(Term *term)
     }
     if(Narsese_isOperator(term->atoms[0])) //atomic operator
     {
-        return Narsese_OperatorIndex(Narsese_atomNames[(int) term->atoms[0]-1]);
+        return operatorIndexOfAtom[(int) term->atoms[0]];
     }
     if(Narsese_isOperation(term)) //an operation, we use the operator atom's index on the right side of the inheritance
     {
-        return Narsese_OperatorIndex(Narsese_atomNames[(int) term->atoms[2]-1]);
+        return operatorIndexOfAtom[(int) term->atoms[2]];
     }
     return 0; //not an operation term
 }
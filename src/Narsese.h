@@ -37,26 +37,29 @@
 #include "Term.h"
 #include "Globals.h"
 #include "Config.h"
+#include "Output.h"
+
+//Parameters//
+//----------//
+//Maximum length of a printed term, an atom name and brackets and spaces for each of its atoms
+#define NARSESE_PRINTED_LEN_MAX (COMPOUND_TERM_SIZE_MAX*(ATOMIC_TERM_LEN_MAX+4)+1)
 
 //Data structure//
 //--------------//
 //Atomic term names:
 char Narsese_atomNames[TERMS_MAX][ATOMIC_TERM_LEN_MAX];
-char Narsese_operatorNames[OPERATIONS_MAX][ATOMIC_TERM_LEN_MAX];
 extern Atom SELF;
 
 //Methods//
 //-------//
-//Initializes encoder
+//Initializes encoder, resetting the atom table shared by all NAR instances, to be called before creating them
 void Narsese_INIT();
-//Expands Narsese into by strtok(str," ") tokenizable string with canonical copulas
-char* Narsese_Expand(char *narsese);
-//Tokenize expanded Narsese in prefix copula order
-char** Narsese_PrefixTransform(char* narsese_expanded);
-//Parses a Narsese string to a compound term
+//Parses a Narsese string to a compound term in a single pass without copying, returns false if malformed
+bool Narsese_ParseTerm(char *narsese, Term *destTerm);
+//Parses a Narsese string to a compound term, asserting that it is well-formed
 Term Narsese_Term(char *narsese);
-//Parses a Narsese string to a compound term and a tv, tv is default if not present
-void Narsese_Sentence(char *narsese, Term *destTerm, char *punctuation, bool *isEvent, Truth *destTv);
+//Parses a Narsese string to a compound term and a tv, tv is default if not present, returns false if malformed
+bool Narsese_Sentence(char *narsese, Term *destTerm, char *punctuation, bool *isEvent, Truth *destTv);
 //Encodes a sequence
 Term Narsese_Sequence(Term *a, Term *b);
 //Parses an atomic term string to a term
@@ -69,6 +72,8 @@ int Narsese_OperatorIndex(char *name);
 void Narsese_PrintAtom(Atom atom);
 //Print a term
 void Narsese_PrintTerm(Term *term);
+//Writes a term to the string, truncated at size, returns the length
+int Narsese_SprintTerm(Term *term, char *dest, int size);
 //Whether it is a certain copula:
 bool Narsese_copulaEquals(Atom atom, char name);
 //Whether it is an operator
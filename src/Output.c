@@ -0,0 +1,233 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Output.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+int OUTPUT_FLUSH_POLICY = OUTPUT_FLUSH_POLICY_INITIAL;
+bool OUTPUT_BOUNDED_LOSS = OUTPUT_BOUNDED_LOSS_INITIAL;
+bool OUTPUT_ENABLED = OUTPUT_ENABLED_INITIAL;
+long Output_droppedLines = 0;
+//Ring buffer, the positions only grow, so head - tail is the used size:
+static char ring[OUTPUT_BUFFER_SIZE];
+static size_t ringHead = 0; //written by the producers, one at a time
+static size_t ringTail = 0; //written by the writer thread
+//Line which is currently formatted by the producer:
+static char line[OUTPUT_LINE_MAX];
+static int lineLen = 0;
+static bool lineDroppable = false;
+static bool lineDropped = false; //whether the current line is dropped
+static bool linePartCommitted = false; //whether a part of the current line was committed already, it can't be dropped anymore then
+#pragma omp threadprivate(line, lineLen, lineDroppable, lineDropped, linePartCommitted) //each thread stages its own line
+static bool async = false;
+static bool stopRequested = false;
+static pthread_t writer;
+
+static void Output_Sleep()
+{
+    struct timespec ts = { .tv_sec = 0, .tv_nsec = OUTPUT_WRITER_SLEEP_US * 1000L };
+    nanosleep(&ts, NULL);
+}
+
+static double Output_Milliseconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+}
+
+static void *Output_Writer(void *arg)
+{
+    (void) arg;
+    bool unflushed = false;
+    double lastFlush = Output_Milliseconds();
+    for(;;)
+    {
+        size_t tail = __atomic_load_n(&ringTail, __ATOMIC_RELAXED);
+        size_t head = __atomic_load_n(&ringHead, __ATOMIC_ACQUIRE);
+        if(head != tail)
+        {
+            size_t start = tail % OUTPUT_BUFFER_SIZE;
+            size_t n = MIN(head - tail, OUTPUT_BUFFER_SIZE - start);
+            fwrite(&ring[start], 1, n, stdout);
+            __atomic_store_n(&ringTail, tail + n, __ATOMIC_RELEASE);
+            unflushed = true;
+        }
+        if(unflushed && OUTPUT_FLUSH_POLICY == OUTPUT_FLUSH_INTERVAL && Output_Milliseconds() - lastFlush >= OUTPUT_FLUSH_INTERVAL_MS)
+        {
+            fflush(stdout);
+            lastFlush = Output_Milliseconds();
+            unflushed = false;
+        }
+        if(head == tail)
+        {
+            if(unflushed && OUTPUT_FLUSH_POLICY == OUTPUT_FLUSH_DRAINED)
+            {
+                fflush(stdout);
+                unflushed = false;
+            }
+            if(__atomic_load_n(&stopRequested, __ATOMIC_ACQUIRE))
+            {
+                break;
+            }
+            Output_Sleep();
+        }
+    }
+    fflush(stdout);
+    return NULL;
+}
+
+//Commits a (part of a) line if the buffer has space for it, only called by one producer at a time
+static bool Output_TryCommit(char *str, size_t len)
+{
+    size_t head = __atomic_load_n(&ringHead, __ATOMIC_RELAXED);
+    if(OUTPUT_BUFFER_SIZE - (head - __atomic_load_n(&ringTail, __ATOMIC_ACQUIRE)) < len)
+    {
+        return false;
+    }
+    size_t start = head % OUTPUT_BUFFER_SIZE;
+    size_t n = MIN(len, OUTPUT_BUFFER_SIZE - start);
+    memcpy(&ring[start], str, n);
+    memcpy(ring, str + n, len - n);
+    __atomic_store_n(&ringHead, head + len, __ATOMIC_RELEASE);
+    return true;
+}
+
+//Commits the staged (part of the) line, waits outside of the critical section while the buffer is full,
+//unless the line can be dropped as a whole as none of it was committed yet
+static void Output_CommitLine()
+{
+    while(!lineDropped)
+    {
+        bool committed;
+        #pragma omp critical(Output)
+        {
+            committed = Output_TryCommit(line, lineLen);
+        }
+        if(committed)
+        {
+            linePartCommitted = true;
+            break;
+        }
+        if(lineDroppable && OUTPUT_BOUNDED_LOSS && !linePartCommitted)
+        {
+            lineDropped = true;
+            break;
+        }
+        Output_Sleep();
+    }
+    lineLen = 0;
+}
+
+static void Output_Write(char *str, size_t len)
+{
+    if(!async)
+    {
+        fwrite(str, 1, len, stdout);
+        return;
+    }
+    for(size_t i=0; i<len; i++)
+    {
+        line[lineLen++] = str[i];
+        if(str[i] == '\n')
+        {
+            Output_CommitLine();
+            if(lineDropped)
+            {
+                __atomic_add_fetch(&Output_droppedLines, 1, __ATOMIC_RELAXED);
+            }
+            lineDroppable = lineDropped = linePartCommitted = false;
+        }
+        else
+        if(lineLen == OUTPUT_LINE_MAX)
+        {
+            Output_CommitLine(); //commit the part, too long lines are rare
+        }
+    }
+}
+
+void Output_Puts(char *str)
+{
+    if(!OUTPUT_ENABLED)
+    {
+        return;
+    }
+    Output_Write(str, strlen(str));
+}
+
+void Output_Printf(char *format, ...)
+{
+    if(!OUTPUT_ENABLED)
+    {
+        return;
+    }
+    char formatted[OUTPUT_LINE_MAX];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(formatted, OUTPUT_LINE_MAX, format, args);
+    va_end(args);
+    Output_Write(formatted, MIN(MAX(len, 0), OUTPUT_LINE_MAX-1));
+}
+
+void Output_MarkDroppable()
+{
+    //the line is only dropped as a whole, so not once a part of it was committed
+    lineDroppable = true;
+}
+
+void Output_Start()
+{
+    static bool stopAtExit = false;
+    if(async)
+    {
+        return;
+    }
+    fflush(stdout);
+    stopRequested = false;
+    async = true;
+    assert(pthread_create(&writer, NULL, Output_Writer, NULL) == 0, "Output writer thread could not be started");
+    if(!stopAtExit)
+    {
+        atexit(Output_Stop);
+        stopAtExit = true;
+    }
+}
+
+void Output_Stop()
+{
+    if(!async)
+    {
+        return;
+    }
+    if(lineLen > 0)
+    {
+        Output_CommitLine();
+    }
+    __atomic_store_n(&stopRequested, true, __ATOMIC_RELEASE);
+    pthread_join(writer, NULL);
+    async = false;
+}
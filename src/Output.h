@@ -0,0 +1,69 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_OUTPUT
+#define H_OUTPUT
+
+////////////////////////
+//  Buffered output   //
+////////////////////////
+//Output channel for derivations, answers and executions.
+//Synchronous by default, in asynchronous mode the lines are committed to a lock-free ring buffer
+//which is drained by a writer thread, so that reasoning doesn't stall on a slow consumer.
+//In asynchronous mode each thread stages its own lines, so that lines of concurrently running NAR instances don't interleave.
+
+//References//
+//-----------//
+#include <stdio.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include "Globals.h"
+#include "Config.h"
+
+//Parameters//
+//----------//
+#define OUTPUT_FLUSH_DRAINED 0  //flush whenever the writer drained the buffer, keeps interactive use responsive
+#define OUTPUT_FLUSH_INTERVAL 1 //flush at most every OUTPUT_FLUSH_INTERVAL_MS
+#define OUTPUT_FLUSH_NEVER 2    //leave flushing to stdio, best for log files
+extern int OUTPUT_FLUSH_POLICY;
+//Whether droppable lines (derivations) are dropped instead of waiting when the buffer is full
+extern bool OUTPUT_BOUNDED_LOSS;
+//Whether output is written at all
+extern bool OUTPUT_ENABLED;
+extern long Output_droppedLines;
+
+//Methods//
+//-------//
+//Starts the writer thread, the buffer is drained on exit
+void Output_Start();
+//Drains the buffer and stops the writer thread, output is synchronous thereafter
+void Output_Stop();
+//Writes a string, lines are committed at their newline
+void Output_Puts(char *str);
+//Writes a formatted string, lines are committed at their newline
+void Output_Printf(char *format, ...);
+//Marks the current line as droppable under back-pressure in bounded loss mode
+void Output_MarkDroppable();
+
+#endif
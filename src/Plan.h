@@ -22,39 +22,38 @@
  * THE SOFTWARE.
  */
 
-#ifndef HASHTABLE_H
-#define HASHTABLE_H
+#ifndef H_PLAN
+#define H_PLAN
 
-/////////////////
-//  HashTable  //
-/////////////////
-//The hashtable HT[Term] -> Concept*
+//////////////
+//  Plan    //
+//////////////
+//The subgoals the best-first planner derived for a goal, memoised across cycles
 
 //References//
 //-----------//
-#include <stdlib.h>
-#include <stdbool.h>
-#include "Stack.h"
+#include "Implication.h"
+#include "Event.h"
+#include "Config.h"
 
 //Data structure//
 //--------------//
-typedef struct
-{
-    VMItem storage[CONCEPTS_MAX];
-    Stack VMStack; //"Virtual memory" stack
-    VMItem* HT[CONCEPTS_MAX]; //the hash of the concept term is the index
-} HashTable;
-
-//Methods//
-//-------//
-//Get a concept from the hashtable via term
-Concept *HashTable_Get(HashTable *hashtable, Term *term);
-//Add a concept to the hashtable using the concept term
-void HashTable_Set(HashTable *hashtable, Concept *c);
-//Delete a concept from hashtable (the concept's term is the key)
-void HashTable_Delete(HashTable *hashtable, Concept *c);
-//Initialize hashtable "virtual memory" stack and HT array
-void HashTable_Init(HashTable *hashtable);
+typedef struct {
+    void *concept; //the concept the subgoal is for
+    long conceptId; //to check whether it's still the same
+    int parent; //index of the subgoal it was derived from, -1 if it's the goal itself
+    Implication imp; //it was derived from the parent with
+    Term term; //of the subgoal, specialized if the implication has variables
+    double desire; //truth expectation of the subgoal
+    bool expanded;
+    long tablesRevision; //of the concept's implication tables when it was expanded
+} Subgoal;
+typedef struct {
+    Term goal;
+    Truth truth;
+    Subgoal subgoals[PLAN_SIZE];
+    int amount;
+    long lastUsed;
+} Plan;
 
 #endif
-
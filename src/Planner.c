@@ -0,0 +1,247 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Planner.h"
+
+bool BEST_FIRST_PLANNING = BEST_FIRST_PLANNING_INITIAL;
+int PLANNING_EXPANSION_BUDGET = PLANNING_EXPANSION_BUDGET_INITIAL;
+
+//Sum of the revisions of the concept's implication tables, as these only grow it changes with each table change
+static long Planner_TablesRevision(NAR *nar, Concept *c)
+{
+    long revision = 0;
+    int opi;
+    for(Table *table = Memory_NextPreconditionBeliefs(nar, c, NULL, &opi); table != NULL; table = Memory_NextPreconditionBeliefs(nar, c, table, &opi))
+    {
+        revision += table->revision;
+    }
+    return revision;
+}
+
+//The memoised plan stays valid while its concepts weren't recycled, the tables of the expanded ones weren't revised,
+//and the goal still matches the same concepts
+static bool Planner_Valid(NAR *nar, Plan *plan, int goalConcepts)
+{
+    int roots = 0;
+    for(int i=0; i<plan->amount; i++)
+    {
+        Subgoal *subgoal = &plan->subgoals[i];
+        Concept *c = subgoal->concept;
+        if(c->id != subgoal->conceptId || (subgoal->expanded && Planner_TablesRevision(nar, c) != subgoal->tablesRevision))
+        {
+            return false;
+        }
+        if(subgoal->parent == -1)
+        {
+            if(c->incoming_goal_spike.type == EVENT_TYPE_DELETED)
+            {
+                return false;
+            }
+            roots++;
+        }
+    }
+    return roots == goalConcepts;
+}
+
+//The plan of the goal, or the least recently used one, reset for the goal
+static Plan *Planner_Find(NAR *nar, Event *goal, int goalConcepts)
+{
+    Plan *lru = &nar->plans[0];
+    for(int i=0; i<PLANS_MAX; i++)
+    {
+        Plan *plan = &nar->plans[i];
+        if(plan->amount > 0 && Term_Equal(&plan->goal, &goal->term) && Truth_Equal(&plan->truth, &goal->truth))
+        {
+            if(Planner_Valid(nar, plan, goalConcepts))
+            {
+                nar->plansReused++;
+                return plan;
+            }
+            nar->plansInvalidated++;
+            lru = plan;
+            break;
+        }
+        if(plan->lastUsed < lru->lastUsed)
+        {
+            lru = plan;
+        }
+    }
+    lru->goal = goal->term;
+    lru->truth = goal->truth;
+    lru->amount = 0;
+    return lru;
+}
+
+static Decision Planner_Consider(NAR *nar, Concept *c, Event *subgoal, long currentTime)
+{
+    Memory_printAddedEvent(nar, subgoal, 1, false, true, false);
+    if(Truth_Confidence(subgoal->truth) <= MIN_CONFIDENCE || Truth_Expectation(subgoal->truth) <= PROPAGATION_THRESHOLD)
+    {
+        return (Decision) {0};
+    }
+    int slot = Memory_ConceptSlot(nar, c);
+    nar->concept_usage[slot] = Usage_use(nar->concept_usage[slot], currentTime);
+    return Decision_Suggest(nar, subgoal, currentTime);
+}
+
+//Adds the subgoal derived from the parent via the implication, term is the specialized precondition if the implication has variables
+static Decision Planner_Add(NAR *nar, Plan *plan, Event *spikes, int parent, Concept *c, Implication *imp, Term *term, long currentTime)
+{
+    Event spike = Inference_GoalDeduction(&spikes[parent], imp);
+    if(term != NULL)
+    {
+        spike.term = *term;
+    }
+    //the first derivation of a subgoal stems from the most desired parent, which is expanded first
+    for(int i=0; i<plan->amount; i++)
+    {
+        if(plan->subgoals[i].concept == c && Term_Equal(&plan->subgoals[i].term, &spike.term))
+        {
+            return (Decision) {0};
+        }
+    }
+    if(plan->amount == PLAN_SIZE)
+    {
+        return (Decision) {0};
+    }
+    int added = plan->amount++;
+    plan->subgoals[added] = (Subgoal) { .concept = c, .conceptId = c->id, .parent = parent, .imp = *imp, .term = spike.term,
+                                        .desire = Truth_Expectation(spike.truth) };
+    spikes[added] = spike;
+    return Planner_Consider(nar, c, &spikes[added], currentTime);
+}
+
+//Adds the subgoals of the expanded one, one for each implication it's the postcondition of
+static Decision Planner_Expand(NAR *nar, Plan *plan, Event *spikes, int expanded, long currentTime)
+{
+    Concept *postc = plan->subgoals[expanded].concept;
+    int opi;
+    for(Table *table = Memory_NextPreconditionBeliefs(nar, postc, NULL, &opi); table != NULL; table = Memory_NextPreconditionBeliefs(nar, postc, table, &opi))
+    {
+        for(int j=0; j<table->itemsAmount; j++)
+        {
+            Implication *imp = Table_At(table, j);
+            IN_DEBUG( assert(Memory_ImplicationValid(imp), "Implications of recycled concepts should have been removed"); )
+            Decision decision = {0};
+            if(!Variable_hasVariable(&imp->term, true, true, true))
+            {
+                decision = Planner_Add(nar, plan, spikes, expanded, imp->sourceConcept, imp, NULL, currentTime);
+            }
+            else
+            {
+                //the precondition is specialized to the concepts it matches with
+                Term right_side = Term_ExtractSubterm(&imp->term, 2);
+                Substitution subs = Variable_Unify(&right_side, &spikes[expanded].term);
+                if(!subs.success)
+                {
+                    continue;
+                }
+                Term left_side_with_op = Term_ExtractSubterm(&imp->term, 1);
+                Term left_side = Narsese_GetPreconditionWithoutOp(&left_side_with_op);
+                Term left_side_substituted = Variable_ApplySubstitute(left_side, subs);
+                for(int concept_i=0; concept_i<nar->concepts.itemsAmount && !decision.execute; concept_i++)
+                {
+                    Concept *pre = nar->concepts.items[concept_i].address;
+                    if(Variable_Unify(Memory_ConceptTerm(nar, pre), &left_side_substituted).success)
+                    {
+                        decision = Planner_Add(nar, plan, spikes, expanded, pre, imp, &left_side_substituted, currentTime);
+                    }
+                }
+            }
+            if(decision.execute)
+            {
+                return decision;
+            }
+        }
+    }
+    plan->subgoals[expanded].expanded = true;
+    plan->subgoals[expanded].tablesRevision = Planner_TablesRevision(nar, postc);
+    return (Decision) {0};
+}
+
+Decision Planner_Plan(NAR *nar, Event *goal, long currentTime)
+{
+    int goalConcepts = 0;
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
+    {
+        goalConcepts += (nar->concept_flags[nar->concepts.items[i].handle] & CONCEPT_FLAG_INCOMING_GOAL_SPIKE) != 0;
+    }
+    Plan *plan = Planner_Find(nar, goal, goalConcepts);
+    plan->lastUsed = currentTime;
+    Event spikes[PLAN_SIZE];
+    if(plan->amount == 0)
+    {
+        for(int i=0; i<nar->concepts.itemsAmount && plan->amount < PLAN_SIZE; i++)
+        {
+            Concept *c = nar->concepts.items[i].address;
+            if(nar->concept_flags[nar->concepts.items[i].handle] & CONCEPT_FLAG_INCOMING_GOAL_SPIKE)
+            {
+                plan->subgoals[plan->amount++] = (Subgoal) { .concept = c, .conceptId = c->id, .parent = -1, .term = c->incoming_goal_spike.term,
+                                                             .desire = Truth_Expectation(c->incoming_goal_spike.truth) };
+            }
+        }
+    }
+    //re-derive the memoised subgoals, their desire values only change with the implications, the goal itself was considered already
+    for(int i=0; i<plan->amount; i++)
+    {
+        Subgoal *subgoal = &plan->subgoals[i];
+        Concept *c = subgoal->concept;
+        if(subgoal->parent == -1)
+        {
+            spikes[i] = c->incoming_goal_spike;
+            continue;
+        }
+        spikes[i] = Inference_GoalDeduction(&spikes[subgoal->parent], &subgoal->imp);
+        spikes[i].term = subgoal->term;
+        Decision decision = Planner_Consider(nar, c, &spikes[i], currentTime);
+        if(decision.execute)
+        {
+            return decision;
+        }
+    }
+    //continue with expanding the most desired subgoals
+    for(int expansions=0; expansions<PLANNING_EXPANSION_BUDGET; expansions++)
+    {
+        int best = -1;
+        for(int i=0; i<plan->amount; i++)
+        {
+            Subgoal *subgoal = &plan->subgoals[i];
+            if(!subgoal->expanded && subgoal->desire > PROPAGATION_THRESHOLD && (best == -1 || subgoal->desire > plan->subgoals[best].desire))
+            {
+                best = i;
+            }
+        }
+        if(best == -1)
+        {
+            break;
+        }
+        nar->planningExpansions++;
+        Decision decision = Planner_Expand(nar, plan, spikes, best, currentTime);
+        if(decision.execute)
+        {
+            return decision;
+        }
+    }
+    return (Decision) {0};
+}
@@ -22,28 +22,30 @@
  * THE SOFTWARE.
  */
 
-void Stack_Test()
-{
-    puts(">>Stack test start");
-    Stack stack = {0};
-    Concept c1 = {0};
-    Concept c2 = {0};
-    VMItem item1 = { .value = &c1 };
-    VMItem item2 = { .value = &c2 };
-    Stack_Push(&stack, &item1);
-    assert(stack.stackpointer == 1, "Stackpointer wasn't incremented");
-    assert(stack.items[0]->value == &c1, "Item should point to c1");
-    assert(!Stack_IsEmpty(&stack), "Stack should not be empty");
-    VMItem *item1_popped = Stack_Pop(&stack);
-    assert(stack.stackpointer == 0, "Stackpointer wasn't decremented");
-    assert(item1_popped->value == &c1, "Popped item1 should point to c1 (1)");
-    Stack_Push(&stack, &item1);
-    Stack_Push(&stack, &item2);
-    assert(stack.stackpointer == 2, "Stackpointer wrong");
-    VMItem *item2_popped = Stack_Pop(&stack);
-    assert(item2_popped->value == &c2, "Popped item2 should point to c2");
-    VMItem *item1_popped_again = Stack_Pop(&stack);
-    assert(item1_popped_again->value == &c1, "Popped item1 should point to c1 (2)");
-    assert(Stack_IsEmpty(&stack), "Stack should be empty");
-    puts(">>Stack test successul");
-}
+#ifndef H_PLANNER
+#define H_PLANNER
+
+/////////////////////////////
+//  Best-first planner     //
+/////////////////////////////
+//Alternative to propagating goal spikes through all concepts PROPAGATION_ITERATIONS times:
+//The subgoals of a goal are expanded in order of their desire, within an expansion budget per cycle.
+//The derived subgoals are memoised for the goal, so that following cycles only re-derive their desire values
+//and continue the expansion, till the implication tables of an expanded subgoal's concept are revised.
+
+//References//
+//-----------//
+#include "Decision.h"
+#include "Variable.h"
+
+//Parameters//
+//----------//
+extern bool BEST_FIRST_PLANNING;
+extern int PLANNING_EXPANSION_BUDGET;
+
+//Methods//
+//-------//
+//Plan for the goal which was processed, its concepts received it as incoming goal spike, returns the best decision found
+Decision Planner_Plan(NAR *nar, Event *goal, long currentTime);
+
+#endif
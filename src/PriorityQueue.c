@@ -24,11 +24,17 @@
 
 #include "PriorityQueue.h"
 
-void PriorityQueue_RESET(PriorityQueue *queue, Item *items, int maxElements)
+void PriorityQueue_RESET(PriorityQueue *queue, Item *items, int *slots, int maxElements)
 {
     queue->items = items;
+    queue->slots = slots;
     queue->maxElements = maxElements;
     queue->itemsAmount = 0;
+    for(int i=0; i<maxElements; i++)
+    {
+        items[i].handle = i;
+        slots[i] = i;
+    }
 }
 
 #define at(i) (queue->items[i])
@@ -38,6 +44,8 @@ static void swap(PriorityQueue *queue, int index1, int index2)
     Item temp = at(index1);
     at(index1) = at(index2);
     at(index2) = temp;
+    queue->slots[at(index1).handle] = index1;
+    queue->slots[at(index2).handle] = index2;
 }
 
 static bool isOnMaxLevel(int i)
@@ -180,7 +188,7 @@ bool PriorityQueue_PopMin(PriorityQueue *queue, void** returnItemAddress, double
     }
     if(returnItemPriority != NULL)
     {
-        *returnItemPriority = item.priority;
+        *returnItemPriority = Numeric_ToReal(item.priority);
     }
     return true;
 }
@@ -202,7 +210,7 @@ bool PriorityQueue_PopMax(PriorityQueue *queue, void** returnItemAddress, double
     }
     if(returnItemPriority != NULL)
     {
-        *returnItemPriority = item.priority;
+        *returnItemPriority = Numeric_ToReal(item.priority);
     }
     return true;
 }
@@ -213,8 +221,8 @@ PriorityQueue_Push_Feedback PriorityQueue_Push(PriorityQueue *queue, double prio
     //first evict if necessary
     if(queue->itemsAmount >= queue->maxElements)
     {
-		double minPriority = at(0).priority;
-        if(priority < minPriority)
+		Numeric minPriority = at(0).priority;
+        if(Numeric_FromReal(priority) < minPriority)
         { //smaller than smallest
             return feedback;
         }
@@ -222,7 +230,7 @@ PriorityQueue_Push_Feedback PriorityQueue_Push(PriorityQueue *queue, double prio
         feedback.evictedItem.priority = minPriority;
         PriorityQueue_PopMin(queue, &feedback.evictedItem.address, NULL);
     }
-    at(queue->itemsAmount).priority = priority;
+    at(queue->itemsAmount).priority = Numeric_FromReal(priority);
     if(feedback.evicted)
     {
         at(queue->itemsAmount).address = feedback.evictedItem.address; 
@@ -234,6 +242,55 @@ PriorityQueue_Push_Feedback PriorityQueue_Push(PriorityQueue *queue, double prio
     return feedback;
 }
 
+void PriorityQueue_PushBatch(PriorityQueue *queue, double *priorities, int amount, PriorityQueue_Push_Feedback *feedbacks)
+{
+    //appending all and rebuilding once pays off when they are many compared to the queue and all fit
+    if(queue->itemsAmount + amount > queue->maxElements || amount * 8 < queue->itemsAmount)
+    {
+        for(int i=0; i<amount; i++)
+        {
+            PriorityQueue_Push_Feedback feedback = PriorityQueue_Push(queue, priorities[i]);
+            if(feedbacks != NULL)
+            {
+                feedbacks[i] = feedback;
+            }
+        }
+        return;
+    }
+    for(int i=0; i<amount; i++)
+    {
+        at(queue->itemsAmount).priority = Numeric_FromReal(priorities[i]);
+        if(feedbacks != NULL)
+        {
+            feedbacks[i] = (PriorityQueue_Push_Feedback) { .added = true, .addedItem = at(queue->itemsAmount) };
+        }
+        queue->itemsAmount++;
+    }
+    PriorityQueue_Rebuild(queue);
+}
+
+int PriorityQueue_PopMaxBatch(PriorityQueue *queue, int amount, void** returnItemAddresses, double* returnItemPriorities)
+{
+    int popped = 0;
+    for(; popped<amount; popped++)
+    {
+        if(!PriorityQueue_PopMax(queue, &returnItemAddresses[popped], returnItemPriorities == NULL ? NULL : &returnItemPriorities[popped]))
+        {
+            break;
+        }
+    }
+    return popped;
+}
+
+//Restores the heap property for the element at index i after its priority changed
+static void PriorityQueue_Restore(PriorityQueue *queue, int i)
+{
+    bubbleUp(queue, i);
+    //either the element didn't move up and might have to move down,
+    //or it was swapped with its parent which now has to move down on the other kind of level
+    trickleDown(queue, i, isOnMaxLevel(i));
+}
+
 bool PriorityQueue_PopAt(PriorityQueue *queue, int i, void** returnItemAddress)
 {
     if(queue->itemsAmount == 0)
@@ -243,7 +300,10 @@ bool PriorityQueue_PopAt(PriorityQueue *queue, int i, void** returnItemAddress)
     Item item = at(i);
     swap(queue, i, queue->itemsAmount-1); 
     queue->itemsAmount--;
-    trickleDown(queue, i, true); //enforce minmax heap property
+    if(i < queue->itemsAmount)
+    {
+        PriorityQueue_Restore(queue, i); //enforce minmax heap property
+    }
     if(returnItemAddress != NULL)
     {
         *returnItemAddress = item.address; 
@@ -251,10 +311,23 @@ bool PriorityQueue_PopAt(PriorityQueue *queue, int i, void** returnItemAddress)
     return true;
 }
 
+int PriorityQueue_IndexOf(PriorityQueue *queue, int handle)
+{
+    int i = queue->slots[handle];
+    return i < queue->itemsAmount ? i : -1;
+}
+
+void PriorityQueue_Update(PriorityQueue *queue, int i, double priority)
+{
+    at(i).priority = Numeric_FromReal(priority);
+    PriorityQueue_Restore(queue, i);
+}
+
 void PriorityQueue_Rebuild(PriorityQueue *queue)
 {
-    for(int i=0; i<queue->itemsAmount; i++)
+    //Floyd's method, the subtrees below a node are heaps before it's trickled down
+    for(int i=parent(queue->itemsAmount-1); i>=0; i--)
     {
-        bubbleUp(queue, i);
+        trickleDown(queue, i, isOnMaxLevel(i));
     }
 }
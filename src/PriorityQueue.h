@@ -36,18 +36,21 @@
 //-----------//
 #include <stdlib.h>
 #include <stdbool.h>
+#include "Globals.h"
 
 //Data structure//
 //--------------//
 typedef struct
 {
-    double priority;
+    Numeric priority;
     void *address;
+    int handle; //the item's index in the storage, stays with the item while it moves in the heap
 } Item;
 
 typedef struct
 {
     Item *items;
+    int *slots; //heap index of the item of each handle
     int itemsAmount;
     int maxElements;
 } PriorityQueue;
@@ -62,19 +65,27 @@ typedef struct
 
 //Methods//
 //-------//
-//Resets the priority queue
-void PriorityQueue_RESET(PriorityQueue *queue, Item *items, int maxElements);
+//Resets the priority queue, the items get the handles 0 to maxElements-1
+void PriorityQueue_RESET(PriorityQueue *queue, Item *items, int *slots, int maxElements);
 //Push element of a certain priority into the queue.
 //If successful, addedItem will point to the item in the data structure, with address of the evicted item, if eviction happened
 PriorityQueue_Push_Feedback PriorityQueue_Push(PriorityQueue *queue, double priority);
+//Push elements of the priorities, as a whole if they fit, feedbacks can be NULL
+void PriorityQueue_PushBatch(PriorityQueue *queue, double *priorities, int amount, PriorityQueue_Push_Feedback *feedbacks);
 //use this function and add again if maybe lower!
 bool PriorityQueue_PopAt(PriorityQueue *queue, int i, void** returnItemAddress);
-//Rebuilds the data structure by re-inserting all elements:
+//Heap index of the item of the handle, -1 if it's not in the queue
+int PriorityQueue_IndexOf(PriorityQueue *queue, int handle);
+//Changes the priority of the element at index i in O(log n)
+void PriorityQueue_Update(PriorityQueue *queue, int i, double priority);
+//Rebuilds the data structure after the priorities were changed, bottom-up in O(n)
 void PriorityQueue_Rebuild(PriorityQueue *queue);
 //Pops minimum element
 bool PriorityQueue_PopMin(PriorityQueue *queue, void** returnItemAddress, double* returnItemPriority);
 //Pops maximum element
 bool PriorityQueue_PopMax(PriorityQueue *queue, void** returnItemAddress, double* returnItemPriority);
+//Pops up to amount maximum elements in descending order, returns how many were popped, priorities can be NULL
+int PriorityQueue_PopMaxBatch(PriorityQueue *queue, int amount, void** returnItemAddresses, double* returnItemPriorities);
 
 #endif
 
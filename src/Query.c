@@ -0,0 +1,257 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Query.h"
+#include "Memory.h"
+
+void Query_INIT(NAR *nar)
+{
+    Queries *queries = &nar->queries;
+    queries->itemsAmount = 0;
+    queries->wildcards = -1;
+    for(int i=0; i<QUERY_BUCKETS; i++)
+    {
+        queries->buckets[i] = -1;
+    }
+}
+
+//Questions without variables are indexed by their hash, the others by their root atom
+static int Query_ExactBucket(Term *term)
+{
+    return (unsigned long) Term_Hash(term) % QUERY_BUCKETS;
+}
+
+static int Query_RootBucket(Term *term)
+{
+    return (uint8_t) term->atoms[0] % QUERY_BUCKETS;
+}
+
+static int *Query_BucketHead(Queries *queries, int bucket)
+{
+    return bucket < 0 ? &queries->wildcards : &queries->buckets[bucket];
+}
+
+static void Query_Unlink(Queries *queries, int index)
+{
+    int *link = Query_BucketHead(queries, queries->items[index].bucket);
+    for(; *link != index; link = &queries->items[*link].next);
+    *link = queries->items[index].next;
+}
+
+static void Query_Link(Queries *queries, int index)
+{
+    Query *q = &queries->items[index];
+    if(!Variable_hasVariable(&q->question, true, true, true))
+    {
+        q->bucket = Query_ExactBucket(&q->question);
+    }
+    else
+    {
+        q->bucket = Variable_isVariable(q->question.atoms[0]) ? -1 : Query_RootBucket(&q->question);
+    }
+    int *head = Query_BucketHead(queries, q->bucket);
+    q->next = *head;
+    *head = index;
+}
+
+static double Query_Expectation(Query *q, Truth truth, long occurrenceTime, long currentTime)
+{
+    return Truth_Expectation(q->isEvent ? Truth_Projection(truth, occurrenceTime, currentTime) : truth);
+}
+
+//Considers a candidate answer for a query whose question unifies with it
+static void Query_Consider(Query *q, Term *term, Truth truth, long occurrenceTime, long creationTime, long currentTime)
+{
+    bool sameTerm = Term_Equal(term, &q->answer.term);
+    if(Query_Expectation(q, truth, occurrenceTime, currentTime) >= Query_Expectation(q, q->answer.truth, q->answer.occurrenceTime, currentTime))
+    {
+        q->answer = (Answer) { .term = *term, .truth = truth, .occurrenceTime = occurrenceTime, .creationTime = creationTime };
+    }
+    else
+    if(sameTerm)
+    {
+        q->dirty = true; //the answer got weaker, another one might be the best now
+    }
+}
+
+Answer Query_Scan(NAR *nar, Term *question, bool isEvent, long currentTime)
+{
+    Answer best = { .truth = Truth_New(0.0, 1.0), .occurrenceTime = OCCURRENCE_ETERNAL };
+    Truth best_truth_projected = {0};
+    bool isImplication = Narsese_copulaEquals(question->atoms[0], '$');
+    //compare the predicate of implication, or if it's not an implication, the term
+    Term toCompare = isImplication ? Term_ExtractSubterm(question, 2) : *question;
+    Term subject = Term_ExtractSubterm(question, 1);
+    int op_k = isImplication ? Narsese_getOperationID(&subject) : 0;
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
+    {
+        Concept *c = nar->concepts.items[i].address;
+        if(!Variable_Unify(&toCompare, Memory_ConceptTerm(nar, c)).success)
+        {
+            continue;
+        }
+        if(isImplication)
+        {
+            Table *table = Memory_PreconditionBeliefs(nar, c, op_k, false);
+            for(int j=0; table != NULL && j<table->itemsAmount; j++)
+            {
+                Implication *imp = Table_At(table, j);
+                if(Variable_Unify(question, &imp->term).success && Truth_Expectation(imp->truth) >= Truth_Expectation(best.truth))
+                {
+                    best = (Answer) { .term = imp->term, .truth = imp->truth, .occurrenceTime = OCCURRENCE_ETERNAL, .creationTime = imp->creationTime };
+                }
+            }
+        }
+        else
+        if(isEvent)
+        {
+            Event *spikes[2] = { &c->belief_spike, &c->predicted_belief };
+            for(int k=0; k<2; k++)
+            {
+                if(spikes[k]->type != EVENT_TYPE_DELETED)
+                {
+                    Truth potential_best_truth = Truth_Projection(spikes[k]->truth, spikes[k]->occurrenceTime, currentTime);
+                    if(Truth_Expectation(potential_best_truth) >= Truth_Expectation(best_truth_projected))
+                    {
+                        best_truth_projected = potential_best_truth;
+                        best = (Answer) { .term = spikes[k]->term, .truth = spikes[k]->truth, .occurrenceTime = spikes[k]->occurrenceTime, .creationTime = spikes[k]->creationTime };
+                    }
+                }
+            }
+        }
+        else
+        {
+            if(c->belief.type != EVENT_TYPE_DELETED && Truth_Expectation(c->belief.truth) >= Truth_Expectation(best.truth))
+            {
+                best = (Answer) { .term = c->belief.term, .truth = c->belief.truth, .occurrenceTime = OCCURRENCE_ETERNAL, .creationTime = c->belief.creationTime };
+            }
+        }
+    }
+    return best;
+}
+
+Answer Query_Ask(NAR *nar, Term *question, bool isEvent, long currentTime)
+{
+    Queries *queries = &nar->queries;
+    int index = -1;
+    int *head = Query_BucketHead(queries, Variable_hasVariable(question, true, true, true) ? 
+                                 (Variable_isVariable(question->atoms[0]) ? -1 : Query_RootBucket(question)) : Query_ExactBucket(question));
+    for(int i = *head; i != -1; i = queries->items[i].next)
+    {
+        if(queries->items[i].isEvent == isEvent && Term_Equal(&queries->items[i].question, question))
+        {
+            index = i;
+            break;
+        }
+    }
+    if(index == -1)
+    {
+        //register it, replacing the least recently asked one if full
+        if(queries->itemsAmount < QUERIES_MAX)
+        {
+            index = queries->itemsAmount++;
+        }
+        else
+        {
+            index = 0;
+            for(int i=1; i<QUERIES_MAX; i++)
+            {
+                if(queries->items[i].lastAsked < queries->items[index].lastAsked)
+                {
+                    index = i;
+                }
+            }
+            Query_Unlink(queries, index);
+        }
+        queries->items[index] = (Query) { .question = *question, .isEvent = isEvent, .isImplication = Narsese_copulaEquals(question->atoms[0], '$'), .dirty = true };
+        Query_Link(queries, index);
+    }
+    Query *q = &queries->items[index];
+    if(q->dirty)
+    {
+        q->answer = Query_Scan(nar, question, isEvent, currentTime);
+        q->dirty = false;
+    }
+    q->lastAsked = currentTime;
+    return q->answer;
+}
+
+//Calls Query_Consider for the queries of the bucket whose question unifies with the term
+static void Query_UpdateBucket(Queries *queries, int head, Term *term, bool isImplication, bool isEvent, Truth truth, long occurrenceTime, long creationTime, long currentTime)
+{
+    for(int i = head; i != -1; i = queries->items[i].next)
+    {
+        Query *q = &queries->items[i];
+        if(!q->dirty && q->isImplication == isImplication && q->isEvent == isEvent && Variable_Unify(&q->question, term).success)
+        {
+            Query_Consider(q, term, truth, occurrenceTime, creationTime, currentTime);
+        }
+    }
+}
+
+static void Query_Update(Queries *queries, Term *term, bool isImplication, bool isEvent, Truth truth, long occurrenceTime, long creationTime, long currentTime)
+{
+    if(queries->itemsAmount == 0)
+    {
+        return;
+    }
+    int exact = Query_ExactBucket(term), root = Query_RootBucket(term);
+    Query_UpdateBucket(queries, queries->buckets[exact], term, isImplication, isEvent, truth, occurrenceTime, creationTime, currentTime);
+    if(root != exact)
+    {
+        Query_UpdateBucket(queries, queries->buckets[root], term, isImplication, isEvent, truth, occurrenceTime, creationTime, currentTime);
+    }
+    Query_UpdateBucket(queries, queries->wildcards, term, isImplication, isEvent, truth, occurrenceTime, creationTime, currentTime);
+}
+
+void Query_UpdateBelief(NAR *nar, Event *belief, bool isEvent, long currentTime)
+{
+    if(belief->type != EVENT_TYPE_DELETED)
+    {
+        Query_Update(&nar->queries, &belief->term, false, isEvent, belief->truth, isEvent ? belief->occurrenceTime : OCCURRENCE_ETERNAL, belief->creationTime, currentTime);
+    }
+}
+
+void Query_UpdateImplication(NAR *nar, Implication *imp)
+{
+    Query_Update(&nar->queries, &imp->term, true, false, imp->truth, OCCURRENCE_ETERNAL, imp->creationTime, 0);
+}
+
+void Query_Removed(NAR *nar, Term *term)
+{
+    for(int i=0; i<nar->queries.itemsAmount; i++)
+    {
+        Query *q = &nar->queries.items[i];
+        if(Term_Equal(&q->answer.term, term))
+        {
+            q->dirty = true;
+        }
+        else
+        if(q->isImplication)
+        {
+            Term predicate = Term_ExtractSubterm(&q->answer.term, 2);
+            q->dirty |= Term_Equal(&predicate, term);
+        }
+    }
+}
@@ -0,0 +1,94 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_QUERY
+#define H_QUERY
+
+//////////////////////////
+//  Standing questions  //
+//////////////////////////
+//Questions are registered as standing queries, indexed by term pattern,
+//and their best answer is updated as beliefs are added and revised, so repeated questions are answered in O(1).
+//An answer which got weaker or was forgotten marks the query dirty, which makes the next ask rescan the memory.
+//Event answers are compared by their truth projected to the time they were added.
+
+//References//
+//-----------//
+#include "Event.h"
+#include "Implication.h"
+#include "Variable.h"
+
+//Parameters//
+//----------//
+//Maximum amount of standing queries, the least recently asked one is replaced
+#define QUERIES_MAX 64
+//Amount of index buckets
+#define QUERY_BUCKETS 128
+
+//Data structure//
+//--------------//
+typedef struct
+{
+    Term term;
+    Truth truth;
+    long occurrenceTime;
+    long creationTime;
+} Answer;
+
+typedef struct
+{
+    Term question;
+    bool isEvent;
+    bool isImplication;
+    bool dirty;
+    Answer answer;
+    long lastAsked;
+    int bucket; //index bucket, -1 for the wildcard list
+    int next; //next query in the same bucket, -1 at the end
+} Query;
+
+typedef struct
+{
+    Query items[QUERIES_MAX];
+    int itemsAmount;
+    int buckets[QUERY_BUCKETS]; //first query of each bucket, -1 if empty
+    int wildcards; //queries which can't be indexed by their root atom
+} Queries;
+
+//Methods//
+//-------//
+//Removes all standing queries
+void Query_INIT(NAR *nar);
+//Full memory scan for the best answer
+Answer Query_Scan(NAR *nar, Term *question, bool isEvent, long currentTime);
+//Answers the question, registering it as standing query if not already registered
+Answer Query_Ask(NAR *nar, Term *question, bool isEvent, long currentTime);
+//Updates the matching standing queries with an added or revised belief
+void Query_UpdateBelief(NAR *nar, Event *belief, bool isEvent, long currentTime);
+//Updates the matching standing queries with an added or revised implication
+void Query_UpdateImplication(NAR *nar, Implication *imp);
+//Marks standing queries dirty which have the term as answer, or implication answer with it as predicate
+void Query_Removed(NAR *nar, Term *term);
+
+#endif
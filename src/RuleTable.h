@@ -37,8 +37,11 @@
 
 //Methods//
 //-------//
-void RuleTable_Apply(Term term1, Term term2, Truth truth1, Truth truth2, long conclusionOccurrence, Stamp conclusionStamp, 
+void RuleTable_Apply(NAR *nar, Term term1, Term term2, Truth truth1, Truth truth2, long conclusionOccurrence, Stamp conclusionStamp, 
                      long currentTime, double parentPriority, double conceptPriority, bool doublePremise, Concept *validation_concept, long validation_cid);
 Term RuleTable_Reduce(Term term1, bool doublePremise);
+//Names of the rules applied by RuleTable_Apply, indexed by rule ID
+extern char *RuleTable_RuleNames[];
+extern int RuleTable_RulesAmount;
 
 #endif
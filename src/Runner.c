@@ -0,0 +1,81 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Runner.h"
+
+static void *Runner_Run(void *instance)
+{
+    NAR *nar = instance;
+    struct timespec next;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+    long period_ns = nar->runnerCyclesPerSecond > 0 ? (long) (1000000000.0 / nar->runnerCyclesPerSecond) : 0;
+    while(!__atomic_load_n(&nar->runnerStopRequested, __ATOMIC_ACQUIRE))
+    {
+        NAR_Cycles(nar, 1);
+        if(period_ns > 0)
+        {
+            //sleep till the next cycle is due, cycles which took too long don't accumulate a backlog
+            next.tv_nsec += period_ns;
+            next.tv_sec += next.tv_nsec / 1000000000L;
+            next.tv_nsec %= 1000000000L;
+            struct timespec now;
+            clock_gettime(CLOCK_MONOTONIC, &now);
+            long remaining_ns = (next.tv_sec - now.tv_sec) * 1000000000L + (next.tv_nsec - now.tv_nsec);
+            if(remaining_ns <= 0)
+            {
+                next = now;
+            }
+            else
+            {
+                struct timespec remaining = { .tv_sec = remaining_ns / 1000000000L, .tv_nsec = remaining_ns % 1000000000L };
+                nanosleep(&remaining, NULL);
+            }
+        }
+    }
+    return NULL;
+}
+
+void Runner_Start(NAR *nar, double cyclesPerSecond)
+{
+    assert(!nar->runnerActive, "The runner of this instance is already active");
+    nar->runnerCyclesPerSecond = cyclesPerSecond;
+    nar->runnerStopRequested = false;
+    nar->runnerActive = true;
+    assert(pthread_create(&nar->runnerThread, NULL, Runner_Run, nar) == 0, "Runner thread could not be started");
+}
+
+void Runner_Stop(NAR *nar)
+{
+    if(nar->runnerActive)
+    {
+        __atomic_store_n(&nar->runnerStopRequested, true, __ATOMIC_RELEASE);
+        pthread_join(nar->runnerThread, NULL);
+        nar->runnerActive = false;
+    }
+}
+
+bool Runner_NextExecution(NAR *nar, Event *execution)
+{
+    return EventQueue_Pop(&nar->executions, execution);
+}
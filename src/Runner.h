@@ -0,0 +1,51 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_RUNNER
+#define H_RUNNER
+
+//////////////////////////////
+//  Background cycle runner //
+//////////////////////////////
+//Drives a NAR instance on its own thread, at a fixed rate or as fast as possible.
+//Sensor threads queue input with NAR_QueueInput, the cycles add it at their start,
+//and operation executions are delivered through the execution queue instead of invoking the actions,
+//so that neither side waits for the other. While the runner is active, the instance must only be used through these.
+
+//References//
+//-----------//
+#include <pthread.h>
+#include <time.h>
+#include "NAR.h"
+
+//Methods//
+//-------//
+//Starts running cycles on a new thread, cyclesPerSecond <= 0 runs them as fast as possible
+void Runner_Start(NAR *nar, double cyclesPerSecond);
+//Stops the runner thread after its current cycle
+void Runner_Stop(NAR *nar);
+//Takes the oldest execution, an event of the operation term, returns false if there is none
+bool Runner_NextExecution(NAR *nar, Event *execution);
+
+#endif
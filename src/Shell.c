@@ -24,69 +24,86 @@
 
 #include "Shell.h"
 
-static void Shell_op_left(Term args)
+static void Shell_op_left(NAR *nar, Term args)
 {
-    fputs("^left executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^left executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
     
 }
-static void Shell_op_right(Term args)
+static void Shell_op_right(NAR *nar, Term args)
 {
-    fputs("^right executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^right executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
-static void Shell_op_up(Term args)
+static void Shell_op_up(NAR *nar, Term args)
 {
-    fputs("^up executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^up executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
-static void Shell_op_down(Term args)
+static void Shell_op_down(NAR *nar, Term args)
 {
-    fputs("^down executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^down executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
-static void Shell_op_say(Term args)
+static void Shell_op_say(NAR *nar, Term args)
 {
-    fputs("^say executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^say executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
-static void Shell_op_pick(Term args)
+static void Shell_op_pick(NAR *nar, Term args)
 {
-    fputs("^pick executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^pick executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
-static void Shell_op_drop(Term args)
+static void Shell_op_drop(NAR *nar, Term args)
 {
-    fputs("^drop executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^drop executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
-static void Shell_op_go(Term args)
+static void Shell_op_go(NAR *nar, Term args)
 {
-    fputs("^go executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^go executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
-static void Shell_op_activate(Term args)
+static void Shell_op_activate(NAR *nar, Term args)
 {
-    fputs("^activate executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^activate executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
-static void Shell_op_deactivate(Term args)
+static void Shell_op_deactivate(NAR *nar, Term args)
 {
-    fputs("^deactivate executed with args ", stdout); Narsese_PrintTerm(&args); puts("");
+    (void) nar;
+    Output_Puts("^deactivate executed with args "); Narsese_PrintTerm(&args); Output_Puts("\n");
 }
+void Shell_NARInit(NAR *nar)
+{
+    Output_Start(); //shell output is asynchronous
+    Narsese_INIT(); //the shell owns the process, so it starts with a fresh vocabulary as well
+    NAR_INIT(nar);
+    PRINT_DERIVATIONS = true;
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^left"), Shell_op_left); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^right"), Shell_op_right); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^up"), Shell_op_up); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^down"), Shell_op_down);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^say"), Shell_op_say);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^pick"), Shell_op_pick);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^drop"), Shell_op_drop);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^go"), Shell_op_go);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^activate"), Shell_op_activate);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^deactivate"), Shell_op_deactivate);
+}
+
 void Shell_Start()
 {
+    NAR *nar = NAR_New();
 INIT:
-    fflush(stdout);
-    NAR_INIT();
-    PRINT_DERIVATIONS = true;
-    NAR_AddOperation(Narsese_AtomicTerm("^left"), Shell_op_left); 
-    NAR_AddOperation(Narsese_AtomicTerm("^right"), Shell_op_right); 
-    NAR_AddOperation(Narsese_AtomicTerm("^up"), Shell_op_up); 
-    NAR_AddOperation(Narsese_AtomicTerm("^down"), Shell_op_down);
-    NAR_AddOperation(Narsese_AtomicTerm("^say"), Shell_op_say);
-    NAR_AddOperation(Narsese_AtomicTerm("^pick"), Shell_op_pick);
-    NAR_AddOperation(Narsese_AtomicTerm("^drop"), Shell_op_drop);
-    NAR_AddOperation(Narsese_AtomicTerm("^go"), Shell_op_go);
-    NAR_AddOperation(Narsese_AtomicTerm("^activate"), Shell_op_activate);
-    NAR_AddOperation(Narsese_AtomicTerm("^deactivate"), Shell_op_deactivate);
+    Shell_NARInit(nar);
     for(;;)
     {
         char line[1024] = {0};
         if(fgets(line, 1024, stdin) == NULL)
         {
-            Stats_Print(currentTime);
+            Stats_Print(nar);
             exit(0);
         }
         //trim string, for IRC etc. convenience
@@ -101,15 +118,15 @@ INIT:
         int size = strlen(line);
         if(size==0)
         {
-            NAR_Cycles(1);
+            NAR_Cycles(nar, 1);
         }
         else
         {
             //accept commands
             if(line[0] == '/' && line[1] == '/')
             {
-                fputs("Comment: ", stdout);
-                puts(&line[2]); fflush(stdout);
+                Output_Puts("Comment: ");
+                Output_Printf("%s\n", &line[2]);
                 continue;
             }
             else
@@ -125,7 +142,7 @@ INIT:
             else
             if(!strcmp(line,"*stats"))
             {
-                Stats_Print(currentTime);
+                Stats_Print(nar);
             }
             else
             if(!strcmp(line,"quit"))
@@ -138,13 +155,87 @@ INIT:
                 PRINT_DERIVATIONS = true;
             }
             else
+            if(!strcmp(line,"*flush=drained"))
+            {
+                OUTPUT_FLUSH_POLICY = OUTPUT_FLUSH_DRAINED;
+            }
+            else
+            if(!strcmp(line,"*flush=interval"))
+            {
+                OUTPUT_FLUSH_POLICY = OUTPUT_FLUSH_INTERVAL;
+            }
+            else
+            if(!strcmp(line,"*flush=never"))
+            {
+                OUTPUT_FLUSH_POLICY = OUTPUT_FLUSH_NEVER;
+            }
+            else
+            if(!strcmp(line,"*lossy=true"))
+            {
+                OUTPUT_BOUNDED_LOSS = true;
+            }
+            else
+            if(!strcmp(line,"*lossy=false"))
+            {
+                OUTPUT_BOUNDED_LOSS = false;
+            }
+            else
+            if(!strcmp(line,"*trace=off"))
+            {
+                Trace_Stop();
+            }
+            else
+            if(!strncmp(line,"*trace=",strlen("*trace=")))
+            {
+                if(!Trace_Start(&line[strlen("*trace=")]))
+                {
+                    Output_Printf("Trace file could not be opened: %s\n", &line[strlen("*trace=")]);
+                }
+            }
+            else
+            if(!strcmp(line,"*bestfirst=true"))
+            {
+                BEST_FIRST_PLANNING = true;
+            }
+            else
+            if(!strcmp(line,"*bestfirst=false"))
+            {
+                BEST_FIRST_PLANNING = false;
+            }
+            else
+            if(!strncmp(line,"*expansionbudget=",strlen("*expansionbudget=")))
+            {
+                sscanf(&line[strlen("*expansionbudget=")], "%d", &PLANNING_EXPANSION_BUDGET);
+            }
+            else
+            if(!strncmp(line,"*cyclebudget=",strlen("*cyclebudget=")))
+            {
+                sscanf(&line[strlen("*cyclebudget=")], "%lf", &CYCLE_BUDGET_MS);
+            }
+            else
+            if(!strcmp(line,"*fastforward=true"))
+            {
+                CYCLE_FAST_FORWARD = true;
+            }
+            else
+            if(!strcmp(line,"*fastforward=false"))
+            {
+                CYCLE_FAST_FORWARD = false;
+            }
+            else
+            if(!strncmp(line,"*tracesampling=",strlen("*tracesampling=")))
+            {
+                sscanf(&line[strlen("*tracesampling=")], "%ld", &TRACE_SAMPLING);
+                TRACE_SAMPLING = MAX(1, TRACE_SAMPLING);
+            }
+            else
             if(strspn(line, "0123456789"))
             {
                 unsigned int steps;
                 sscanf(line, "%u", &steps);
-                printf("performing %u inference steps:\n", steps); fflush(stdout);
-                NAR_Cycles(steps);
-                printf("done with %u additional inference steps.\n", steps); fflush(stdout);
+                Output_Printf("performing %u inference steps:\n", steps);
+                NAR_Cycles(nar, steps);
+                Output_Printf("done with %u additional inference steps.\n", steps);
             }
             else
             {
@@ -152,126 +243,55 @@ INIT:
                 Truth tv;
                 char punctuation;
                 bool isEvent;
-                Narsese_Sentence(line, &term, &punctuation, &isEvent, &tv);
+                if(!Narsese_Sentence(line, &term, &punctuation, &isEvent, &tv))
+                {
+                    Output_Printf("Parsing error: %s\n", line);
+                    continue;
+                }
 #if STAGE==2
                 //apply reduction rules to term:
                 term = RuleTable_Reduce(term, false);
 #endif
                 //answer questions:
-                Truth best_truth = { .frequency = 0.0, .confidence = 1.0 };
-                Truth best_truth_projected = {0};
-                Term best_term = {0};
-                long answerOccurrenceTime = OCCURRENCE_ETERNAL;
-                long answerCreationTime = 0;
                 if(punctuation == '?')
                 {
-                    bool isImplication = Narsese_copulaEquals(term.atoms[0], '$');
-                    fputs("Input: ", stdout);
+                    Output_Puts("Input: ");
                     Narsese_PrintTerm(&term);
-                    fputs("?", stdout);
-                    puts(isEvent ? " :|:" : ""); 
-                    fflush(stdout);
-                    for(int i=0; i<concepts.itemsAmount; i++)
-                    {
-                        Concept *c = concepts.items[i].address;
-                        //compare the predicate of implication, or if it's not an implication, the term
-                        Term toCompare = isImplication ? Term_ExtractSubterm(&term, 2) : term; 
-                        if(!Variable_Unify(&toCompare, &c->term).success)
-                        {
-                            goto Continue;
-                        }
-                        if(isImplication)
-                        {
-                            Term subject = Term_ExtractSubterm(&term, 1);
-                            int op_k = Narsese_getOperationID(&subject);
-                            for(int j=0; j<c->precondition_beliefs[op_k].itemsAmount; j++)
-                            {
-                                Implication *imp = &c->precondition_beliefs[op_k].array[j];
-                                if(!Variable_Unify(&term, &imp->term).success)
-                                {
-                                    continue;
-                                }
-                                if(Truth_Expectation(imp->truth) >= Truth_Expectation(best_truth))
-                                {
-                                    best_truth = imp->truth;
-                                    best_term = imp->term;
-                                    answerCreationTime = imp->creationTime;
-                                }
-                            }
-                        }
-                        else
-                        if(isEvent)
-                        {
-                            if(c->belief_spike.type != EVENT_TYPE_DELETED)
-                            {
-                                Truth potential_best_truth = Truth_Projection(c->belief_spike.truth, c->belief_spike.occurrenceTime, currentTime);
-                                if(Truth_Expectation(potential_best_truth) >= Truth_Expectation(best_truth_projected))
-                                {
-                                    best_truth_projected = potential_best_truth;
-                                    best_truth = c->belief_spike.truth;
-                                    best_term = c->belief_spike.term;
-                                    answerOccurrenceTime = c->belief_spike.occurrenceTime;
-                                    answerCreationTime = c->belief_spike.creationTime;
-                                }
-                            }
-                            if(c->predicted_belief.type != EVENT_TYPE_DELETED)
-                            {
-                                Truth potential_best_truth = Truth_Projection(c->predicted_belief.truth, c->predicted_belief.occurrenceTime, currentTime);
-                                if(Truth_Expectation(potential_best_truth) >= Truth_Expectation(best_truth_projected))
-                                {
-                                    best_truth_projected = potential_best_truth;
-                                    best_truth = c->predicted_belief.truth;
-                                    best_term = c->predicted_belief.term;
-                                    answerOccurrenceTime = c->predicted_belief.occurrenceTime;
-                                    answerCreationTime = c->predicted_belief.creationTime;
-                                }
-                            }
-                        }
-                        else
-                        {
-                            if(c->belief.type != EVENT_TYPE_DELETED && Truth_Expectation(c->belief.truth) >= Truth_Expectation(best_truth))
-                            {
-                                best_truth = c->belief.truth;
-                                best_term = c->belief.term;
-                                answerCreationTime = c->belief.creationTime;
-                            }
-                        }
-                        Continue:;
-                    }
-                    fputs("Answer: ", stdout);
-                    if(best_truth.confidence == 0)
+                    Output_Puts("?");
+                    Output_Printf("%s\n", isEvent ? " :|:" : ""); 
+                    Answer answer = Query_Ask(nar, &term, isEvent, nar->currentTime);
+                    Output_Puts("Answer: ");
+                    if(Truth_Confidence(answer.truth) == 0)
                     {
-                        puts("None.");
+                        Output_Puts("None.\n");
                     }
                     else
                     {
-                        Narsese_PrintTerm(&best_term);
-                        if(answerOccurrenceTime == OCCURRENCE_ETERNAL)
+                        Narsese_PrintTerm(&answer.term);
+                        if(answer.occurrenceTime == OCCURRENCE_ETERNAL)
                         {
-                            printf(". creationTime=%ld ", answerCreationTime);
+                            Output_Printf(". creationTime=%ld ", answer.creationTime);
                         }
                         else
                         {
-                            printf(". :|: occurrenceTime=%ld creationTime=%ld ", answerOccurrenceTime, answerCreationTime);
+                            Output_Printf(". :|: occurrenceTime=%ld creationTime=%ld ", answer.occurrenceTime, answer.creationTime);
                         }
-                        Truth_Print(&best_truth);
+                        Truth_Print(&answer.truth);
                     }
-                    fflush(stdout);
                 }
                 //input beliefs and goals
                 else
                 {
                     if(punctuation == '!')
                     {
-                        NAR_AddInput(term, EVENT_TYPE_GOAL, NAR_DEFAULT_TRUTH, !isEvent);
+                        NAR_AddInput(nar, term, EVENT_TYPE_GOAL, NAR_DEFAULT_TRUTH, !isEvent);
                     }
                     else
                     {
-                        NAR_AddInput(term, EVENT_TYPE_BELIEF, tv, !isEvent);
+                        NAR_AddInput(nar, term, EVENT_TYPE_BELIEF, tv, !isEvent);
                     }
                 }
             }
         }
-        fflush(stdout);
     }
 }
@@ -35,9 +35,12 @@
 #include "NAR.h"
 #include <ctype.h> 
 #include "Stats.h"
+#include "Planner.h"
 
 //Methods//
 //-------//
+//Inits the NAR with the shell's operations
+void Shell_NARInit(NAR *nar);
 void Shell_Start();
 
 #endif
@@ -24,70 +24,60 @@
 
 #include "Stamp.h"
 
+#define STAMP_BIT(base) (((uint64_t) 1) << ((uint32_t) (base) & 63))
+
+Stamp Stamp_new(long base)
+{
+    return (Stamp) { .summary = STAMP_BIT(base), .evidentalBase = { (int32_t) base }, .length = 1 };
+}
+
 Stamp Stamp_make(Stamp *stamp1, Stamp *stamp2)
 {
     Stamp ret = {0};
-    bool processStamp1 = true;
-    bool processStamp2 = true;
-    for (int j=0, i=0; i<STAMP_SIZE; i++)
+    int j = 0;
+    for(int i=0; i<stamp1->length || i<stamp2->length; i++)
     {
-        if(processStamp1)
+        if(i < stamp1->length)
         {
-            if(stamp1->evidentalBase[i] != STAMP_FREE)
-            {
-                ret.evidentalBase[j] = stamp1->evidentalBase[i];
-                j++;
-                if(j >= STAMP_SIZE)
-                {
-                    break;
-                }
-            }
-            else
+            ret.evidentalBase[j++] = stamp1->evidentalBase[i];
+            ret.summary |= STAMP_BIT(stamp1->evidentalBase[i]);
+            if(j >= STAMP_SIZE)
             {
-                processStamp1 = false;
+                break;
             }
         }
-        if(processStamp2)
+        if(i < stamp2->length)
         {
-            if(stamp2->evidentalBase[i] != STAMP_FREE)
+            ret.evidentalBase[j++] = stamp2->evidentalBase[i];
+            ret.summary |= STAMP_BIT(stamp2->evidentalBase[i]);
+            if(j >= STAMP_SIZE)
             {
-                ret.evidentalBase[j] = stamp2->evidentalBase[i];
-                j++;
-                if(j >= STAMP_SIZE)
-                {
-                    break;
-                }
-            }
-            else
-            {
-                processStamp2 = false;
+                break;
             }
         }
-        if(!processStamp1 && !processStamp2)
-        {
-            break;
-        }
     }
+    ret.length = j;
     return ret;
 }
 
 bool Stamp_checkOverlap(Stamp *a, Stamp *b)
 {
-    for (int i=0;i<STAMP_SIZE;i++)
+    uint64_t common = a->summary & b->summary;
+    if(!common)
     {
-        if (a->evidentalBase[i] == STAMP_FREE) 
-        {
-            break;
-        }
-        for (int j=0;j<STAMP_SIZE;j++)
+        return false;
+    }
+    //exact check, only for the bases which could be shared
+    for(int i=0; i<a->length; i++)
+    {
+        if(common & STAMP_BIT(a->evidentalBase[i]))
         {
-            if (b->evidentalBase[j] == STAMP_FREE)
+            for(int j=0; j<b->length; j++)
             {
-                break;
-            }
-            if (a->evidentalBase[i] == b->evidentalBase[j])
-            {
-                return true;
+                if(a->evidentalBase[i] == b->evidentalBase[j])
+                {
+                    return true;
+                }
             }
         }
     }
@@ -97,13 +87,9 @@ bool Stamp_checkOverlap(Stamp *a, Stamp *b)
 void Stamp_print(Stamp *stamp)
 {
     fputs("stamp=", stdout);
-    for(int i=0; i<STAMP_SIZE; i++)
+    for(int i=0; i<stamp->length; i++)
     {
-        if(stamp->evidentalBase[i] == STAMP_FREE)
-        {
-            break;
-        }
-        printf("%ld,", stamp->evidentalBase[i]);
+        printf("%ld,", (long) stamp->evidentalBase[i]);
     }
     puts("");
 }
@@ -34,19 +34,24 @@
 //----------//
 #include <stdbool.h>
 #include <stdio.h>
+#include <stdint.h>
 #include "Config.h"
 
 //Data structure//
 //--------------//
-//Stamp as implemented by all NARS implementations
+//Stamp as implemented by all NARS implementations, with a summary of the bases:
+//evidence can only overlap if the summaries intersect, so that overlap is mostly ruled out by one AND
 #define STAMP_FREE 0
 typedef struct {
-    //EvidentalBase of stamp
-    long evidentalBase[STAMP_SIZE];
+    uint64_t summary; //bit (base mod 64) of each base, consecutive bases don't share bits
+    int32_t evidentalBase[STAMP_SIZE]; //in the order of Stamp_make, STAMP_FREE after the last one
+    int length;
 } Stamp;
 
 //Methods//
 //-------//
+//stamp with a single evidental base
+Stamp Stamp_new(long base);
 //zip stamp1 and stamp2 into a stamp
 Stamp Stamp_make(Stamp *stamp1, Stamp *stamp2);
 //true iff there is evidental base overlap between a and b
@@ -24,25 +24,44 @@
 
 #include "Stats.h"
 
-long Stats_countConceptsMatchedTotal = 0;
-long Stats_countConceptsMatchedMax = 0;
-
-void Stats_Print(long currentTime)
+void Stats_Print(NAR *nar)
 {
-    puts("Statistics:");
-    printf("countConceptsMatchedTotal:\t%ld\n", Stats_countConceptsMatchedTotal);
-    printf("countConceptsMatchedMax:\t%ld\n", Stats_countConceptsMatchedMax);
-    long countConceptsMatchedAverage = Stats_countConceptsMatchedTotal / currentTime;
-    printf("countConceptsMatchedAverage:\t%ld\n", countConceptsMatchedAverage);
-    printf("currentTime:\t\t\t%ld\n", currentTime);
-    printf("total concepts:\t\t\t%d\n", concepts.itemsAmount);
+    Output_Puts("Statistics:\n");
+    Output_Printf("countConceptsMatchedTotal:\t%ld\n", nar->countConceptsMatchedTotal);
+    Output_Printf("countConceptsMatchedMax:\t%ld\n", nar->countConceptsMatchedMax);
+    long countConceptsMatchedAverage = nar->countConceptsMatchedTotal / nar->currentTime;
+    Output_Printf("countConceptsMatchedAverage:\t%ld\n", countConceptsMatchedAverage);
+    Output_Printf("currentTime:\t\t\t%ld\n", nar->currentTime);
+    Output_Printf("total concepts:\t\t\t%d\n", nar->concepts.itemsAmount);
     int maxlen = 0;
-    for(int i=0; i<CONCEPTS_MAX; i++)
+    for(int i=0; i<INTERNED_TERMS_BUCKETS; i++)
     {
-        VMItem *item = HTconcepts.HT[i];
         int cnt = 0;
-        for(;item != NULL; item=item->next, cnt++);
+        for(TermHandle h = nar->terms.buckets[i]; h != 0; h = nar->terms.entries[h].next, cnt++);
         maxlen = MAX(maxlen, cnt);
     }
-    printf("Maximum chain length in concept hashtable = %d\n", maxlen);
+    Output_Printf("interned terms:\t\t\t%d\n", nar->terms.amount);
+    Output_Printf("Maximum chain length in term store = %d\n", maxlen);
+    Output_Printf("dropped output lines:\t\t%ld\n", Output_droppedLines);
+    Output_Printf("operation tables used:\t\t%d of %d allocated\n", nar->operationTablesUsed, nar->operationTablesAllocated);
+    if(nar->planningExpansions > 0)
+    {
+        Output_Printf("best-first expansions:\t\t%ld\n", nar->planningExpansions);
+        Output_Printf("memoised plans reused:\t\t%ld, invalidated: %ld\n", nar->plansReused, nar->plansInvalidated);
+    }
+    if(nar->operationsDispatched > 0)
+    {
+        Output_Printf("executor operations completed:\t%ld of %ld\n", __atomic_load_n(&nar->operationsCompleted, __ATOMIC_RELAXED), nar->operationsDispatched);
+    }
+    if(nar->countCyclesSkipped > 0)
+    {
+        Output_Printf("idle cycles skipped:\t\t%ld\n", nar->countCyclesSkipped);
+    }
+    if(nar->countRealtimeCycles > 0)
+    {
+        Output_Printf("truncated real-time cycles:\t%ld of %ld\n", nar->countCyclesTruncated, nar->countRealtimeCycles);
+        Output_Printf("skipped propagation iterations:\t%ld\n", nar->countPropagationIterationsSkipped);
+        Output_Printf("skipped concept inferences:\t%ld of %ld\n", nar->countConceptInferencesSkipped, nar->countConceptInferences + nar->countConceptInferencesSkipped);
+        Output_Printf("max. deadline overrun:\t\t%f ms\n", nar->maxDeadlineOverrunMs);
+    }
 }
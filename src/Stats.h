@@ -34,13 +34,9 @@
 #include <stdio.h>
 #include "Memory.h"
 
-//Global vars//
-//-----------//
-extern long Stats_countConceptsMatchedTotal;
-extern long Stats_countConceptsMatchedMax;
-
 //Methods//
 //-------//
-void Stats_Print(long currentTime);
+//Print the statistics of the NAR instance
+void Stats_Print(NAR *nar);
 
 #endif
@@ -23,89 +23,139 @@
  */
 
 #include "Table.h"
+#include "Concept.h"
 
-Implication *Table_Add(Table *table, Implication *imp)
+//Counts the implications in tables by their source concept, so that the memory can remove them when it recycles the concept
+#define Table_CountSourced(imp, delta) (((Concept*) (imp)->sourceConcept)->sourcedImplications += (delta))
+
+//Rank of the implication with the term, -1 if there is none
+static int Table_Find(Table *table, Term *term, TERM_HASH_TYPE hash)
+{
+    for(int i=0; i<table->itemsAmount; i++)
+    {
+        int slot = table->order[i];
+        if(table->hashes[slot] == hash && Term_Equal(&table->array[slot].term, term))
+        {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static Implication *Table_Insert(NAR *nar, Table *table, Implication *imp, TERM_HASH_TYPE hash)
 {
     assert(imp->sourceConcept != NULL, "Attempted to add an implication without source concept!");
     double impTruthExp = Truth_Expectation(imp->truth);
     for(int i=0; i<TABLE_SIZE; i++)
     {
-        bool same_term = (/*table->array[i].term_hash == imp->term_hash &&*/ Term_Equal(&table->array[i].term,&imp->term));
         //either it's not yet full and we reached a new space,
         //or the term is different and the truth expectation is higher
         //or the term is the same and the confidence is higher
-        if(i==table->itemsAmount || (!same_term && impTruthExp > Truth_Expectation(table->array[i].truth)) || (same_term && imp->truth.confidence > table->array[i].truth.confidence))
+        bool same_term = i<table->itemsAmount && table->hashes[table->order[i]] == hash && Term_Equal(&Table_At(table, i)->term, &imp->term);
+        if(i==table->itemsAmount || (!same_term && impTruthExp > table->expectations[i]) || (same_term && imp->truth.confidence > Table_At(table, i)->truth.confidence))
         {
-            //ok here it has to go, move down the rest, evicting the last element if we hit TABLE_SIZE-1.
-            for(int j=MIN(table->itemsAmount, TABLE_SIZE-1); j>i; j--)
+            //ok here it has to go, move down the ranks of the rest, evicting the last element if we hit TABLE_SIZE-1
+            int slot;
+            if(table->itemsAmount == TABLE_SIZE)
+            {
+                slot = table->order[TABLE_SIZE-1];
+                Query_Removed(nar, &table->array[slot].term);
+                Table_CountSourced(&table->array[slot], -1);
+                table->itemsAmount--;
+            }
+            else
             {
-                table->array[j] = table->array[j-1];
+                slot = table->itemsAmount < table->slotsAmount ? table->order[table->itemsAmount] : table->slotsAmount++;
             }
-            table->array[i] = *imp;
-            table->itemsAmount = MIN(table->itemsAmount+1, TABLE_SIZE);
-            return &table->array[i];
+            memmove(&table->order[i+1], &table->order[i], (table->itemsAmount-i) * sizeof(int));
+            memmove(&table->expectations[i+1], &table->expectations[i], (table->itemsAmount-i) * sizeof(double));
+            table->order[i] = slot;
+            table->expectations[i] = impTruthExp;
+            table->array[slot] = *imp;
+            table->hashes[slot] = hash;
+            Table_CountSourced(imp, 1);
+            table->itemsAmount++;
+            table->revision++;
+            return &table->array[slot];
         }
     }
     return NULL;
 }
 
-void Table_Remove(Table *table, int index)
+Implication *Table_Add(NAR *nar, Table *table, Implication *imp)
 {
-    //move up the rest beginning at index
-    for(int j=index; j<table->itemsAmount; j++)
-    {
-        table->array[j] = j == table->itemsAmount ? (Implication) {0} : table->array[j+1];
-    }
-    table->itemsAmount = MAX(0, table->itemsAmount-1);
+    return Table_Insert(nar, table, imp, Term_Hash(&imp->term));
+}
+
+static void Table_RemoveAt(Table *table, int index)
+{
+    //move up the ranks of the rest beginning at index, the slot becomes the first free one
+    int slot = table->order[index];
+    Table_CountSourced(&table->array[slot], -1);
+    memmove(&table->order[index], &table->order[index+1], (table->itemsAmount-1-index) * sizeof(int));
+    memmove(&table->expectations[index], &table->expectations[index+1], (table->itemsAmount-1-index) * sizeof(double));
+    table->itemsAmount--;
+    table->order[table->itemsAmount] = slot;
+    table->array[slot] = (Implication) {0};
+    table->revision++;
+}
+
+void Table_Remove(NAR *nar, Table *table, int index)
+{
+    Query_Removed(nar, &Table_At(table, index)->term);
+    Table_RemoveAt(table, index);
 }
 
 static void Table_SantiyCheck(Table *table)
 {
     for(int i=0; i<table->itemsAmount; i++)
     {
+        assert(table->hashes[table->order[i]] == Term_Hash(&Table_At(table, i)->term), "Stored hash doesn't match the term");
         for(int j=0; j<table->itemsAmount; j++)
         {
             if(i != j)
             {
-                assert(!Term_Equal(&table->array[i].term, &table->array[j].term), "THEY CANNOT BE THE SAME\n");
+                assert(!Term_Equal(&Table_At(table, i)->term, &Table_At(table, j)->term), "THEY CANNOT BE THE SAME\n");
             }
         }
     }
 }
 
-Implication *Table_AddAndRevise(Table *table, Implication *imp)
+Implication *Table_AddAndRevise(NAR *nar, Table *table, Implication *imp)
 {
     IN_DEBUG ( Table_SantiyCheck(table); )
     //1. find element with same Term
-    int same_i = -1;
-    for(int i=0; i<table->itemsAmount; i++)
-    {
-        if(/*imp->term_hash == table->array[i].term_hash &&*/ Term_Equal(&imp->term, &table->array[i].term))
-        {
-            same_i = i;
-            break;
-        }
-    }
+    TERM_HASH_TYPE hash = Term_Hash(&imp->term);
+    int same_i = Table_Find(table, &imp->term, hash);
     //2. if there was one, revise with it or apply choice if overlap
     if(same_i != -1)
     {
         //revision adds the revised element, removing the old implication from the table
-        Implication OldImp = table->array[same_i];
-        assert(OldImp.truth.frequency >= 0.0 && OldImp.truth.frequency <= 1.0, "(1) frequency out of bounds");
-        assert(OldImp.truth.confidence >= 0.0 && OldImp.truth.confidence <= 1.0, "(1) confidence out of bounds");
-        assert(imp->truth.frequency >= 0.0 && imp->truth.frequency <= 1.0, "(2) frequency out of bounds");
-        assert(imp->truth.confidence >= 0.0 && imp->truth.confidence <= 1.0, "(2) confidence out of bounds");
+        Implication OldImp = *Table_At(table, same_i);
+        assert(Truth_Frequency(OldImp.truth) >= 0.0 && Truth_Frequency(OldImp.truth) <= 1.0, "(1) frequency out of bounds");
+        assert(Truth_Confidence(OldImp.truth) >= 0.0 && Truth_Confidence(OldImp.truth) <= 1.0, "(1) confidence out of bounds");
+        assert(Truth_Frequency(imp->truth) >= 0.0 && Truth_Frequency(imp->truth) <= 1.0, "(2) frequency out of bounds");
+        assert(Truth_Confidence(imp->truth) >= 0.0 && Truth_Confidence(imp->truth) <= 1.0, "(2) confidence out of bounds");
         Implication revised = Inference_ImplicationRevision(&OldImp, imp);
-        assert(revised.truth.frequency >= 0.0 && revised.truth.frequency <= 1.0, "(3) frequency out of bounds");
-        assert(revised.truth.confidence >= 0.0 && revised.truth.confidence <= 1.0, "(3) confidence out of bounds");
+        assert(Truth_Frequency(revised.truth) >= 0.0 && Truth_Frequency(revised.truth) <= 1.0, "(3) frequency out of bounds");
+        assert(Truth_Confidence(revised.truth) >= 0.0 && Truth_Confidence(revised.truth) <= 1.0, "(3) confidence out of bounds");
         Implication_SetTerm(&revised, imp->term);
-        Table_Remove(table, same_i);
-        Implication *ret = Table_Add(table, &revised);
+        //the revised implication is counted for the source concept of the added one
+        revised.sourceConcept = imp->sourceConcept;
+        revised.sourceConceptId = imp->sourceConceptId;
+        Table_RemoveAt(table, same_i);
+        Implication *ret = Table_Insert(nar, table, &revised, hash);
         assert(ret != NULL, "Deletion and re-addition should have succeeded");
+        Query_UpdateImplication(nar, ret);
         return ret;
     }
     else
     {
-        return Table_Add(table, imp);
+        Implication *ret = Table_Insert(nar, table, imp, hash);
+        if(ret != NULL)
+        {
+            Query_UpdateImplication(nar, ret);
+        }
+        return ret;
     }
 }
@@ -36,23 +36,33 @@
 #include "Globals.h"
 #include <string.h>
 #include "Config.h"
+#include "Query.h"
 
 //Data structure//
 //--------------//
 //A truth-expectation-ranked table for Implications, similar as pre- and post-condition table in OpenNARS,
 //except that this table supports revision by itself (as in NAR implications don't form concepts).
+//The implications stay in their slot while they are in the table, only the slot indices are moved to rank them.
 typedef struct {
-    Implication array[TABLE_SIZE];
+    Implication array[TABLE_SIZE]; //by slot
+    TERM_HASH_TYPE hashes[TABLE_SIZE]; //term hash of the implication in the slot, to find duplicates without comparing terms
+    int order[TABLE_SIZE]; //slots by rank, the used ones followed by the free ones
+    double expectations[TABLE_SIZE]; //truth expectation by rank
     int itemsAmount;
+    int slotsAmount; //slots handed out so far, the first slotsAmount entries of order are a permutation of them
+    long revision; //incremented with each change of the table
 } Table;
 
 //Methods//
 //-------//
+//The implication at the rank, stays at the same address while it's in the table
+#define Table_At(table, rank) (&(table)->array[(table)->order[rank]])
+//(the standing questions of the NAR instance are informed about added and removed implications)
 //Add implication to table
-Implication *Table_Add(Table *table, Implication *imp);
-//Add element at index from table
-void Table_Remove(Table *table, int index);
+Implication *Table_Add(NAR *nar, Table *table, Implication *imp);
+//Remove element at index from table
+void Table_Remove(NAR *nar, Table *table, int index);
 //Add implication to table while allowing revision
-Implication* Table_AddAndRevise(Table *table, Implication *imp);
+Implication* Table_AddAndRevise(NAR *nar, Table *table, Implication *imp);
 
 #endif
@@ -116,3 +116,38 @@ TERM_HASH_TYPE Term_Hash(Term *term)
     }
     return hash;
 }
+
+void Term_SubtermHashes(Term *term, TermHashes *hashes)
+{
+    //bottom-up, as the children come after their parent
+    for(int i=COMPOUND_TERM_SIZE_MAX-1; i>=0; i--)
+    {
+        if(term->atoms[i] == 0)
+        {
+            hashes->hashes[i] = 0;
+            continue;
+        }
+        int left = (i+1)*2-1, right = (i+1)*2+1-1;
+        uint32_t h = (uint8_t) term->atoms[i] * 0x9E3779B1u;
+        h ^= (left < COMPOUND_TERM_SIZE_MAX ? hashes->hashes[left] : 0) * 0x85EBCA77u;
+        h = (h ^ (h >> 15)) * 0xC2B2AE3Du;
+        h ^= (right < COMPOUND_TERM_SIZE_MAX ? hashes->hashes[right] : 0) * 0x27D4EB2Fu;
+        h ^= h >> 13;
+        hashes->hashes[i] = h | 1; //0 is reserved for no atom
+    }
+}
+
+bool Term_SubtermEqual(Term *a, int i, Term *b, int j)
+{
+    Atom atom_a = i < COMPOUND_TERM_SIZE_MAX ? a->atoms[i] : 0;
+    Atom atom_b = j < COMPOUND_TERM_SIZE_MAX ? b->atoms[j] : 0;
+    if(atom_a != atom_b)
+    {
+        return false;
+    }
+    if(atom_a == 0)
+    {
+        return true;
+    }
+    return Term_SubtermEqual(a, (i+1)*2-1, b, (j+1)*2-1) && Term_SubtermEqual(a, (i+1)*2+1-1, b, (j+1)*2+1-1);
+}
@@ -53,6 +53,12 @@ typedef struct
 {
     Atom atoms[COMPOUND_TERM_SIZE_MAX];
 }Term;
+//Hashes of the subterms at each position of a term, a companion of terms which are compared often:
+//equal subterms have equal hashes wherever they are, so that subterms can be compared without extracting them
+typedef struct
+{
+    uint32_t hashes[COMPOUND_TERM_SIZE_MAX]; //0 where there is no atom
+}TermHashes;
 
 //Methods//
 //-------//
@@ -66,7 +72,11 @@ bool Term_OverrideSubterm(Term *term, int i, Term *subterm);
 Term Term_ExtractSubterm(Term *term, int j);
 //The complexity of a term
 int Term_Complexity(Term *term);
-//Hash of a term (needed by the term->concept HashTable)
+//Hash of a term (needed by the term store)
 TERM_HASH_TYPE Term_Hash(Term *term);
+//Hashes of all subterms of a term, each computed from its atom and the hashes of its children
+void Term_SubtermHashes(Term *term, TermHashes *hashes);
+//Whether the subterm of a at position i equals the one of b at position j, compared in place
+bool Term_SubtermEqual(Term *a, int i, Term *b, int j);
 
 #endif
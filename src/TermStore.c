@@ -0,0 +1,110 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "TermStore.h"
+
+static int TermStore_Bucket(TERM_HASH_TYPE hash)
+{
+    return (int) ((unsigned long) hash % INTERNED_TERMS_BUCKETS);
+}
+
+void TermStore_INIT(TermStore *store)
+{
+    for(int i=0; i<INTERNED_TERMS_BUCKETS; i++)
+    {
+        store->buckets[i] = 0;
+    }
+    store->free = store->used = 0;
+    store->amount = 0;
+}
+
+static TermHandle TermStore_Lookup(TermStore *store, Term *term, TERM_HASH_TYPE hash)
+{
+    for(TermHandle h = store->buckets[TermStore_Bucket(hash)]; h != 0; h = store->entries[h].next)
+    {
+        if(store->entries[h].hash == hash && Term_Equal(&store->entries[h].term, term))
+        {
+            return h;
+        }
+    }
+    return 0;
+}
+
+TermHandle TermStore_Find(TermStore *store, Term *term)
+{
+    return TermStore_Lookup(store, term, Term_Hash(term));
+}
+
+TermHandle TermStore_Intern(TermStore *store, Term *term)
+{
+    TERM_HASH_TYPE hash = Term_Hash(term);
+    TermHandle h = TermStore_Lookup(store, term, hash);
+    if(h == 0)
+    {
+        if(store->free != 0)
+        {
+            h = store->free;
+            store->free = store->entries[h].next;
+        }
+        else
+        {
+            assert(store->used < INTERNED_TERMS_MAX, "Term store is full!");
+            h = ++store->used;
+        }
+        int bucket = TermStore_Bucket(hash);
+        store->entries[h] = (TermStore_Entry) { .term = *term, .hash = hash, .next = store->buckets[bucket] };
+        Term_SubtermHashes(term, &store->subtermHashes[h]);
+        store->buckets[bucket] = h;
+        store->amount++;
+    }
+    store->entries[h].refs++;
+    return h;
+}
+
+void TermStore_Retain(TermStore *store, TermHandle handle)
+{
+    assert(handle != 0 && store->entries[handle].refs > 0, "Only interned terms can be retained!");
+    store->entries[handle].refs++;
+}
+
+void TermStore_Release(TermStore *store, TermHandle handle)
+{
+    assert(handle != 0 && store->entries[handle].refs > 0, "Only interned terms can be released!");
+    TermStore_Entry *entry = &store->entries[handle];
+    if(--entry->refs > 0)
+    {
+        return;
+    }
+    //unlink from the bucket and reclaim the entry
+    TermHandle *link = &store->buckets[TermStore_Bucket(entry->hash)];
+    while(*link != handle)
+    {
+        assert(*link != 0, "Interned term is missing in its bucket!");
+        link = &store->entries[*link].next;
+    }
+    *link = entry->next;
+    entry->next = store->free;
+    store->free = handle;
+    store->amount--;
+}
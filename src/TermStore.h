@@ -0,0 +1,80 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_TERMSTORE
+#define H_TERMSTORE
+
+///////////////////
+//  Term store   //
+///////////////////
+//Hash-consed terms: each distinct term is stored once and referenced by a small handle,
+//so that equality of interned terms is an integer compare and their hash is computed once.
+//The holders count their references, a term is reclaimed when its last holder releases it.
+
+//References//
+//-----------//
+#include <stdbool.h>
+#include <stdint.h>
+#include "Globals.h"
+#include "Term.h"
+#include "Config.h"
+
+//Data structure//
+//--------------//
+typedef uint32_t TermHandle; //0 for no term
+typedef struct
+{
+    Term term;
+    TERM_HASH_TYPE hash;
+    int refs;
+    TermHandle next; //next entry of the hash bucket, or of the free entries
+} TermStore_Entry;
+typedef struct
+{
+    TermStore_Entry entries[INTERNED_TERMS_MAX+1]; //entry 0 is unused, so that handle 0 means none
+    TermHashes subtermHashes[INTERNED_TERMS_MAX+1]; //of the entries, kept apart as only some users need them
+    TermHandle buckets[INTERNED_TERMS_BUCKETS]; //first entry of each hash bucket
+    TermHandle free; //first reclaimed entry
+    TermHandle used; //entries taken so far, the ones after it were never written to
+    int amount; //interned terms
+} TermStore;
+
+//Methods//
+//-------//
+//Init the store, invalidating all handles
+void TermStore_INIT(TermStore *store);
+//The handle of the term if it's interned, 0 otherwise
+TermHandle TermStore_Find(TermStore *store, Term *term);
+//The handle of the term, interning it if it isn't yet, the caller holds a reference
+TermHandle TermStore_Intern(TermStore *store, Term *term);
+//Add a reference to an interned term
+void TermStore_Retain(TermStore *store, TermHandle handle);
+//Drop a reference to an interned term, it's reclaimed with its last reference
+void TermStore_Release(TermStore *store, TermHandle handle);
+//The interned term, its hash and the hashes of its subterms
+#define TermStore_Term(store, handle) (&(store)->entries[handle].term)
+#define TermStore_Hash(store, handle) ((store)->entries[handle].hash)
+#define TermStore_SubtermHashes(store, handle) (&(store)->subtermHashes[handle])
+
+#endif
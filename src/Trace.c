@@ -0,0 +1,176 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "Trace.h"
+#include "RuleTable.h"
+
+long TRACE_SAMPLING = TRACE_SAMPLING_INITIAL;
+static FILE *traceFile = NULL;
+static bool atomWritten[TERMS_MAX+1];
+static long knowledgeRecords = 0, decisionRecords = 0;
+
+static void Trace_Write(void *data, size_t size)
+{
+    fwrite(data, 1, size, traceFile);
+}
+
+static void Trace_WriteU8(uint8_t value) { Trace_Write(&value, 1); }
+static void Trace_WriteU16(uint16_t value) { Trace_Write(&value, 2); }
+static void Trace_WriteI64(int64_t value) { Trace_Write(&value, 8); }
+static void Trace_WriteF64(double value) { Trace_Write(&value, 8); }
+
+//Writes the atom names of the term if not written yet, to be called before the record
+static void Trace_WriteAtomNames(Term *term)
+{
+    for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
+    {
+        int atom = (uint8_t) term->atoms[i];
+        if(atom && !atomWritten[atom])
+        {
+            atomWritten[atom] = true;
+            Trace_WriteU8('A');
+            Trace_WriteU8(atom);
+            Trace_WriteU8(strlen(Narsese_atomNames[atom-1]));
+            Trace_Write(Narsese_atomNames[atom-1], strlen(Narsese_atomNames[atom-1]));
+        }
+    }
+}
+
+static void Trace_WriteTerm(Term *term)
+{
+    uint8_t n = COMPOUND_TERM_SIZE_MAX;
+    for(; n>0 && !term->atoms[n-1]; n--);
+    Trace_WriteU8(n);
+    Trace_Write(term->atoms, n);
+}
+
+#if STAGE==2
+static void Trace_WriteName(char *name)
+{
+    size_t len = strlen(name);
+    Trace_WriteU16(len);
+    Trace_Write(name, len);
+}
+#endif
+
+bool Trace_Start(char *path)
+{
+    Trace_Stop();
+    traceFile = fopen(path, "wb");
+    if(traceFile == NULL)
+    {
+        return false;
+    }
+    memset(atomWritten, 0, sizeof(atomWritten));
+    knowledgeRecords = decisionRecords = 0;
+    Trace_Write("YANT", 4);
+    Trace_WriteU16(TRACE_VERSION);
+#if STAGE==2
+    for(int i=0; i<RuleTable_RulesAmount; i++)
+    {
+        Trace_WriteU8('R');
+        Trace_WriteU16(i);
+        Trace_WriteName(RuleTable_RuleNames[i]);
+    }
+#endif
+    return true;
+}
+
+void Trace_Stop()
+{
+    if(traceFile != NULL)
+    {
+        fclose(traceFile);
+        traceFile = NULL;
+    }
+}
+
+bool Trace_Active()
+{
+    return traceFile != NULL;
+}
+
+//Records of concurrently running NAR instances are written one at a time
+static void Trace_WriteKnowledge(Term *term, char type, Truth *truth, Stamp *stamp, long occurrenceTime, long creationTime, double priority, int flags, int rule)
+{
+    Trace_WriteAtomNames(term);
+    Trace_WriteU8('K');
+    Trace_WriteU8(flags);
+    Trace_WriteU8(type);
+    Trace_WriteU16((flags & TRACE_FLAG_INPUT) ? TRACE_RULE_INPUT : rule);
+    Trace_WriteF64(Truth_Frequency(*truth));
+    Trace_WriteF64(Truth_Confidence(*truth));
+    Trace_WriteF64(priority);
+    Trace_WriteI64(occurrenceTime);
+    Trace_WriteI64(creationTime);
+    Trace_WriteU8(stamp->length);
+    for(int i=0; i<stamp->length; i++)
+    {
+        Trace_WriteI64(stamp->evidentalBase[i]);
+    }
+    Trace_WriteTerm(term);
+}
+
+void Trace_Knowledge(Term *term, char type, Truth *truth, Stamp *stamp, long occurrenceTime, long creationTime, double priority, int flags, int rule)
+{
+    if(traceFile == NULL)
+    {
+        return;
+    }
+    #pragma omp critical(Trace)
+    {
+        if(traceFile != NULL && knowledgeRecords++ % TRACE_SAMPLING == 0)
+        {
+            Trace_WriteKnowledge(term, type, truth, stamp, occurrenceTime, creationTime, priority, flags, rule);
+        }
+    }
+}
+
+static void Trace_WriteDecision(int operationID, double desire, Implication *imp, long currentTime)
+{
+    Trace_WriteAtomNames(&imp->term);
+    Trace_WriteU8('X');
+    Trace_WriteU16(operationID);
+    Trace_WriteF64(desire);
+    Trace_WriteF64(Truth_Frequency(imp->truth));
+    Trace_WriteF64(Truth_Confidence(imp->truth));
+    Trace_WriteI64(imp->occurrenceTimeOffset);
+    Trace_WriteI64(currentTime);
+    Trace_WriteTerm(&imp->term);
+}
+
+void Trace_Decision(int operationID, double desire, Implication *imp, long currentTime)
+{
+    if(traceFile == NULL)
+    {
+        return;
+    }
+    #pragma omp critical(Trace)
+    {
+        if(traceFile != NULL && decisionRecords++ % TRACE_SAMPLING == 0)
+        {
+            Trace_WriteDecision(operationID, desire, imp, currentTime);
+        }
+    }
+}
@@ -0,0 +1,76 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef H_TRACE
+#define H_TRACE
+
+/////////////////////
+//  Binary trace   //
+/////////////////////
+//Compact, versioned trace of added knowledge and decisions for offline analysis, see trace_decoder.py.
+//The trace is shared by all NAR instances. All multi-byte fields are in host byte order. The stream starts with the header
+//"YANT" u16 version, followed by records:
+//'A' u8 atom, u8 len, char name[len]:                  atom name, written before the first record using the atom
+//'R' u16 rule, u16 len, char name[len]:                rule table rule name, written at trace start
+//'K' u8 flags, u8 type, u16 rule, f64 frequency, f64 confidence, f64 priority, i64 occurrenceTime, i64 creationTime,
+//    u8 stampLen, i64 stamp[stampLen], u8 n, u8 atoms[n]:           added event or implication
+//'X' u16 operationID, f64 desire, f64 frequency, f64 confidence, i64 occurrenceTimeOffset, i64 currentTime,
+//    u8 n, u8 atoms[n]:                                decision with the implication it is based on
+
+//References//
+//-----------//
+#include <stdio.h>
+#include <stdint.h>
+#include "Implication.h"
+
+//Parameters//
+//----------//
+#define TRACE_VERSION 2
+//Flags of 'K' records
+#define TRACE_FLAG_INPUT 1
+#define TRACE_FLAG_DERIVED 2
+#define TRACE_FLAG_REVISED 4
+#define TRACE_FLAG_IMPLICATION 8
+//Origins beside the rule table rules
+#define TRACE_RULE_INPUT 0xFFFF
+#define TRACE_RULE_SENSORIMOTOR 0xFFFE //temporal induction, subgoaling and revision
+#define TRACE_RULE_VARIABLE_INTRODUCTION 0xFFFD
+#define TRACE_RULE_PREDICTION 0xFFFC
+//Only every TRACE_SAMPLING-th record of each kind is written
+extern long TRACE_SAMPLING;
+
+//Methods//
+//-------//
+//Starts tracing to the file, returns false if it can't be opened
+bool Trace_Start(char *path);
+//Stops tracing, closing the file
+void Trace_Stop();
+//Whether a trace is written
+bool Trace_Active();
+//Trace added knowledge, derived by the rule (or origin)
+void Trace_Knowledge(Term *term, char type, Truth *truth, Stamp *stamp, long occurrenceTime, long creationTime, double priority, int flags, int rule);
+//Trace a decision
+void Trace_Decision(int operationID, double desire, Implication *imp, long currentTime);
+
+#endif
@@ -26,7 +26,17 @@
 
 double TRUTH_EVIDENTAL_HORIZON = TRUTH_EVIDENTAL_HORIZON_INITIAL;
 double TRUTH_PROJECTION_DECAY = TRUTH_PROJECTION_DECAY_INITIAL;
-#define TruthValues(v1,v2, f1,c1, f2,c2) double f1 = v1.frequency; double f2 = v2.frequency; double c1 = v1.confidence; double c2 = v2.confidence;
+#define TruthValues(v1,v2, f1,c1, f2,c2) double f1 = Truth_Frequency(v1); double f2 = Truth_Frequency(v2); double c1 = Truth_Confidence(v1); double c2 = Truth_Confidence(v2);
+
+//Products of stored values, the truth functions which are just products stay in the numeric profile, the others compute with reals
+#if NUMERIC_PROFILE == NUMERIC_FIXED16
+static inline Numeric mul(Numeric a, Numeric b)
+{
+    return (Numeric) (((uint32_t) a * b + NUMERIC_ONE / 2) / NUMERIC_ONE);
+}
+#else
+#define mul(a, b) ((a) * (b))
+#endif
 
 double Truth_w2c(double w)
 {
@@ -40,7 +50,7 @@ double Truth_c2w(double c)
 
 double Truth_Expectation(Truth v)
 {
-    return (v.confidence * (v.frequency - 0.5) + 0.5);
+    return (Truth_Confidence(v) * (Truth_Frequency(v) - 0.5) + 0.5);
 }
 
 Truth Truth_Revision(Truth v1, Truth v2)
@@ -49,21 +59,20 @@ Truth Truth_Revision(Truth v1, Truth v2)
     double w1 = Truth_c2w(c1);
     double w2 = Truth_c2w(c2);
     double w = w1 + w2;
-    return (Truth) { .frequency = MIN(1.0, (w1 * f1 + w2 * f2) / w), 
-                     .confidence = MIN(MAX_CONFIDENCE, MAX(MAX(Truth_w2c(w), c1), c2)) };
+    return Truth_New(MIN(1.0, (w1 * f1 + w2 * f2) / w), 
+                     MIN(MAX_CONFIDENCE, MAX(MAX(Truth_w2c(w), c1), c2)));
 }
 
 Truth Truth_Deduction(Truth v1, Truth v2)
 {
-    TruthValues(v1,v2, f1,c1, f2,c2);
-    double f = f1 * f2;
-    return (Truth) { .frequency = f, .confidence = c1 * c2 * f };
+    Numeric f = mul(v1.frequency, v2.frequency);
+    return (Truth) { .frequency = f, .confidence = mul(mul(v1.confidence, v2.confidence), f) };
 }
 
 Truth Truth_Abduction(Truth v1, Truth v2)
 {
     TruthValues(v1,v2, f1,c1, f2,c2);
-    return (Truth) { .frequency = f1, .confidence = Truth_w2c(f2 * c1 * c2) };
+    return Truth_New(f1, Truth_w2c(f2 * c1 * c2));
 }
 
 Truth Truth_Induction(Truth v1, Truth v2)
@@ -73,25 +82,84 @@ Truth Truth_Induction(Truth v1, Truth v2)
 
 Truth Truth_Intersection(Truth v1, Truth v2)
 {
-    TruthValues(v1,v2, f1,c1, f2,c2);
-    return (Truth) { .frequency = f1 * f2, .confidence = c1 * c2 };
+    return (Truth) { .frequency = mul(v1.frequency, v2.frequency), .confidence = mul(v1.confidence, v2.confidence) };
 }
 
 Truth Truth_Eternalize(Truth v)
 {
-    return (Truth) { .frequency = v.frequency, .confidence = Truth_w2c(v.confidence) };
+    return (Truth) { .frequency = v.frequency, .confidence = Numeric_FromReal(Truth_w2c(Truth_Confidence(v))) };
+}
+
+//Powers of the projection decay for the time distances the table covers, built when the decay is set,
+//so that the concurrently running inference only reads it
+static Numeric projectionDecayTable[TRUTH_PROJECTION_TABLE_SIZE];
+static double projectionDecayTableDecay = -1.0; //decay the table was built for
+
+void Truth_INIT()
+{
+    for(int i=0; i<TRUTH_PROJECTION_TABLE_SIZE; i++)
+    {
+        projectionDecayTable[i] = Numeric_FromReal(pow(TRUTH_PROJECTION_DECAY, i)); //same values as computing the power each time
+    }
+    projectionDecayTableDecay = TRUTH_PROJECTION_DECAY;
+}
+
+void Truth_SetProjectionDecay(double decay)
+{
+    TRUTH_PROJECTION_DECAY = decay;
+    Truth_INIT();
+}
+
+Numeric Truth_ProjectionDecay(long difference)
+{
+    if(difference >= TRUTH_PROJECTION_TABLE_SIZE)
+    {
+        return Numeric_FromReal(pow(TRUTH_PROJECTION_DECAY, difference));
+    }
+    IN_DEBUG( assert(projectionDecayTableDecay == TRUTH_PROJECTION_DECAY, "The projection decay has to be set with Truth_SetProjectionDecay"); )
+    return projectionDecayTable[difference];
 }
 
 Truth Truth_Projection(Truth v, long originalTime, long targetTime)
 {
-    double difference = labs(targetTime - originalTime);
     return originalTime == OCCURRENCE_ETERNAL ? 
-           v : (Truth) { .frequency = v.frequency, .confidence = v.confidence * pow(TRUTH_PROJECTION_DECAY,difference) };
+           v : (Truth) { .frequency = v.frequency, .confidence = mul(v.confidence, Truth_ProjectionDecay(labs(targetTime - originalTime))) };
+}
+
+void Truth_ProjectionBatch(Truth *v, long *originalTimes, long targetTime, Truth *result, int n)
+{
+    Numeric decays[TRUTH_BATCH_SIZE];
+    assert(n <= TRUTH_BATCH_SIZE, "Batch exceeds TRUTH_BATCH_SIZE");
+    for(int i=0; i<n; i++)
+    {
+        decays[i] = originalTimes[i] == OCCURRENCE_ETERNAL ? NUMERIC_ONE : Truth_ProjectionDecay(labs(targetTime - originalTimes[i]));
+    }
+    for(int i=0; i<n; i++)
+    {
+        result[i] = (Truth) { .frequency = v[i].frequency, .confidence = mul(v[i].confidence, decays[i]) };
+    }
+}
+
+void Truth_DeductionBatch(Truth *restrict v1, Truth *restrict v2, Truth *restrict result, int n)
+{
+    for(int i=0; i<n; i++)
+    {
+        Numeric f = mul(v1[i].frequency, v2[i].frequency);
+        result[i] = (Truth) { .frequency = f, .confidence = mul(mul(v1[i].confidence, v2[i].confidence), f) };
+    }
+}
+
+void Truth_ExpectationBatch(Truth *restrict v, double *restrict result, int n)
+{
+    for(int i=0; i<n; i++)
+    {
+        result[i] = Truth_Confidence(v[i]) * (Truth_Frequency(v[i]) - 0.5) + 0.5;
+    }
 }
 
 void Truth_Print(Truth *truth)
 {
-    printf("Truth: frequency=%f, confidence=%f\n", truth->frequency, truth->confidence);
+    Output_Printf("Truth: frequency=%f, confidence=%f\n", Truth_Frequency(*truth), Truth_Confidence(*truth));
 }
 
 //not part of MSC:
@@ -99,7 +167,7 @@ void Truth_Print(Truth *truth)
 Truth Truth_Exemplification(Truth v1, Truth v2)
 {
     TruthValues(v1,v2, f1,c1, f2,c2);
-    return (Truth) { .frequency = 1.0, .confidence = Truth_w2c(f1 * f2 * c1 * c2) };
+    return Truth_New(1.0, Truth_w2c(f1 * f2 * c1 * c2));
 }
 
 static inline double or(double a, double b)
@@ -111,42 +179,39 @@ Truth Truth_Comparison(Truth v1, Truth v2)
 {
     TruthValues(v1,v2, f1,c1, f2,c2);
     double f0 = or(f1, f2);
-    return (Truth) { .frequency = (f0 == 0.0) ? 0.0 : ((f1*f2) / f0), .confidence = Truth_w2c(f0 * c1 * c2) };
+    return Truth_New((f0 == 0.0) ? 0.0 : ((f1*f2) / f0), Truth_w2c(f0 * c1 * c2));
 }
 
 Truth Truth_Analogy(Truth v1, Truth v2)
 {
-    TruthValues(v1,v2, f1,c1, f2,c2);
-    return (Truth) { .frequency = f1 * f2, .confidence = c1 * c2 * f2 };
+    return (Truth) { .frequency = mul(v1.frequency, v2.frequency), .confidence = mul(mul(v1.confidence, v2.confidence), v2.frequency) };
 }
 
 Truth Truth_Resemblance(Truth v1, Truth v2)
 {
     TruthValues(v1,v2, f1,c1, f2,c2);
-    return (Truth) { .frequency = f1 * f2, .confidence = c1 * c2 * or(f1, f2) };
+    return Truth_New(f1 * f2, c1 * c2 * or(f1, f2));
 }
 
 Truth Truth_Union(Truth v1, Truth v2)
 {
     TruthValues(v1,v2, f1,c1, f2,c2);
-    return (Truth) { .frequency = or(f1, f2), .confidence = c1 * c2 };
+    return Truth_New(or(f1, f2), c1 * c2);
 }
 
 Truth Truth_Difference(Truth v1, Truth v2)
 {
-    TruthValues(v1,v2, f1,c1, f2,c2);
-    return (Truth) { .frequency = f1 * (1.0 - f2), .confidence = c1 * c2 };
+    return (Truth) { .frequency = mul(v1.frequency, NUMERIC_ONE - v2.frequency), .confidence = mul(v1.confidence, v2.confidence) };
 }
 
 Truth Truth_Conversion(Truth v1, Truth v2)
 {
-    return (Truth) { .frequency = 1.0, .confidence = Truth_w2c(v1.frequency * v1.confidence) };
+    return Truth_New(1.0, Truth_w2c(Truth_Frequency(v1) * Truth_Confidence(v1)));
 }
 
 Truth Truth_Negation(Truth v1, Truth v2)
 {
-    TruthValues(v1,v2, f1,c1, f2,c2);
-    return (Truth) { .frequency = 1.0-f1, .confidence = c1 };
+    return (Truth) { .frequency = NUMERIC_ONE - v1.frequency, .confidence = v1.confidence };
 }
 
 Truth Truth_StructuralDeduction(Truth v1, Truth v2)
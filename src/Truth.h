@@ -36,25 +36,34 @@
 #include <stdlib.h>
 #include "Globals.h"
 #include "Config.h"
+#include "Output.h"
 
 //Data structure//
 //--------------//
 typedef struct {
     //Frequency
-    double frequency;
+    Numeric frequency;
     //Confidence
-    double confidence;
+    Numeric confidence;
 } Truth;
+//Truth value of the real frequency and confidence, and the real values of a truth value
+#define Truth_New(f, c) ((Truth) { .frequency = Numeric_FromReal(f), .confidence = Numeric_FromReal(c) })
+#define Truth_Frequency(v) Numeric_ToReal((v).frequency)
+#define Truth_Confidence(v) Numeric_ToReal((v).confidence)
 
 //Parameters//
 //----------//
 extern double TRUTH_EVIDENTAL_HORIZON;
-extern double TRUTH_PROJECTION_DECAY;
+extern double TRUTH_PROJECTION_DECAY; //set with Truth_SetProjectionDecay
 #define OCCURRENCE_ETERNAL -1
-#define STRUCTURAL_TRUTH (Truth) { .frequency = 1.0, .confidence = RELIANCE }
+#define STRUCTURAL_TRUTH Truth_New(1.0, RELIANCE)
 
 //Methods//
 //-------//
+//Tabulate the powers of the projection decay, before instances are created
+void Truth_INIT();
+//Set the projection decay, not while instances are reasoning, as the table they read is rebuilt
+void Truth_SetProjectionDecay(double decay);
 double Truth_w2c(double w);
 double Truth_c2w(double c);
 double Truth_Expectation(Truth v);
@@ -64,6 +73,12 @@ Truth Truth_Induction(Truth v1, Truth v2);
 Truth Truth_Intersection(Truth v1, Truth v2);
 Truth Truth_Eternalize(Truth v);
 Truth Truth_Projection(Truth v, long originalTime, long targetTime);
+//Factor the confidence decays by when projected over the time distance
+Numeric Truth_ProjectionDecay(long difference);
+//Truth functions over arrays of (at most TRUTH_BATCH_SIZE) truth values, for scoring many candidates at once
+void Truth_ProjectionBatch(Truth *v, long *originalTimes, long targetTime, Truth *result, int n);
+void Truth_DeductionBatch(Truth *v1, Truth *v2, Truth *result, int n);
+void Truth_ExpectationBatch(Truth *v, double *result, int n);
 void Truth_Print(Truth *truth);
 //not part of MSC:
 Truth Truth_Abduction(Truth v1, Truth v2);
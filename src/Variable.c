@@ -67,16 +67,21 @@ Substitution Variable_Unify(Term *general, Term *specific)
         {
             if(Variable_isVariable(general_atom))
             {
-                Term subtree = Term_ExtractSubterm(specific, i);
-                if(Variable_isQueryVariable(general_atom) && Variable_isVariable(subtree.atoms[0])) //not valid to substitute a variable for a question var
+                if(Variable_isQueryVariable(general_atom) && Variable_isVariable(specific->atoms[i])) //not valid to substitute a variable for a question var
                 {
                     return substitution;
                 }
-                if(substitution.map[(int) general_atom].atoms[0] != 0 && !Term_Equal(&substitution.map[(int) general_atom], &subtree)) //unificiation var consistency criteria
+                if(substitution.map[(int) general_atom].atoms[0] != 0)
                 {
-                    return substitution;
+                    if(!Term_SubtermEqual(&substitution.map[(int) general_atom], 0, specific, i)) //unificiation var consistency criteria, compared in place
+                    {
+                        return substitution;
+                    }
+                }
+                else
+                {
+                    substitution.map[(int) general_atom] = Term_ExtractSubterm(specific, i);
                 }
-                substitution.map[(int) general_atom] = subtree;
             }
             else
             {
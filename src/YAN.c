@@ -0,0 +1,247 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "YAN.h"
+#include "NAR.h"
+
+//Added knowledge, kept as term until it's taken
+typedef struct
+{
+    Term term;
+    char type;
+    Truth truth;
+    long occurrenceTime;
+    double priority;
+    int flags;
+} YAN_Derivation;
+
+typedef struct
+{
+    YAN_Operation callback;
+    void *userdata;
+    Term term;
+} YAN_Callback;
+
+struct YAN
+{
+    NAR *nar;
+    YAN_Callback *operations; //indexed by operator index-1, grown as operations are added
+    int operationsAmount;
+    //Ring buffer of added knowledge, the positions only grow:
+    YAN_Derivation derivations[YAN_DERIVATIONS_MAX];
+    long derivationsHead;
+    long derivationsTail;
+    long derivationsDropped;
+};
+
+void YAN_Init()
+{
+    assert(NARSESE_PRINTED_LEN_MAX <= YAN_TERM_LEN_MAX, "YAN_TERM_LEN_MAX is too small for the printed terms of this configuration");
+    Truth_INIT();
+    Narsese_INIT();
+    OUTPUT_ENABLED = false;
+}
+
+//Called with the instance's derivation lock held, the YAN_ flags mirror the trace flags
+static void YAN_KnowledgeAdded(NAR *nar, Term *term, char type, Truth *truth, long occurrenceTime, double priority, int flags)
+{
+    YAN *yan = nar->owner;
+    if(yan->derivationsHead - yan->derivationsTail == YAN_DERIVATIONS_MAX)
+    {
+        yan->derivationsTail++;
+        yan->derivationsDropped++;
+    }
+    yan->derivations[yan->derivationsHead % YAN_DERIVATIONS_MAX] = (YAN_Derivation) { .term = *term, .type = type, .truth = *truth,
+                                                                                      .occurrenceTime = occurrenceTime, .priority = priority, .flags = flags };
+    yan->derivationsHead++;
+}
+
+static void YAN_OperationInvoked(NAR *nar, Term args)
+{
+    YAN *yan = nar->owner;
+    YAN_Callback *op = &yan->operations[nar->executedOperationID-1];
+    char printedArgs[NARSESE_PRINTED_LEN_MAX];
+    Narsese_SprintTerm(&args, printedArgs, NARSESE_PRINTED_LEN_MAX);
+    op->callback(yan, Narsese_atomNames[(int) op->term.atoms[0]-1], printedArgs, op->userdata);
+}
+
+YAN *YAN_New()
+{
+    YAN *yan = calloc(1, sizeof(YAN));
+    assert(yan != NULL, "Not enough memory for another YAN instance");
+    yan->nar = NAR_New();
+    yan->nar->owner = yan;
+    yan->nar->knowledgeHandler = YAN_KnowledgeAdded;
+    return yan;
+}
+
+void YAN_Free(YAN *yan)
+{
+    NAR_Free(yan->nar);
+    free(yan->operations);
+    free(yan);
+}
+
+void YAN_Reset(YAN *yan)
+{
+    NAR_INIT(yan->nar);
+    for(int i=0; i<yan->operationsAmount; i++)
+    {
+        if(yan->operations[i].callback != NULL)
+        {
+            NAR_AddOperation(yan->nar, yan->operations[i].term, YAN_OperationInvoked);
+        }
+    }
+    yan->derivationsHead = yan->derivationsTail = yan->derivationsDropped = 0;
+}
+
+//Parses a sentence from a copy, as the parser takes mutable strings
+static bool YAN_Parse(const char *narsese, Term *term, char *punctuation, bool *isEvent, Truth *truth)
+{
+    char sentence[NARSESE_LEN_MAX];
+    if(strlen(narsese) >= NARSESE_LEN_MAX)
+    {
+        return false;
+    }
+    strcpy(sentence, narsese);
+    *truth = NAR_DEFAULT_TRUTH;
+    if(!Narsese_Sentence(sentence, term, punctuation, isEvent, truth))
+    {
+        return false;
+    }
+#if STAGE==2
+    //apply reduction rules to term:
+    *term = RuleTable_Reduce(*term, false);
+#endif
+    return true;
+}
+
+bool YAN_AddInput(YAN *yan, const char *narsese)
+{
+    Term term;
+    Truth truth;
+    char punctuation;
+    bool isEvent;
+    if(!YAN_Parse(narsese, &term, &punctuation, &isEvent, &truth) || punctuation == '?')
+    {
+        return false;
+    }
+    if(punctuation == '!')
+    {
+        NAR_AddInput(yan->nar, term, EVENT_TYPE_GOAL, NAR_DEFAULT_TRUTH, !isEvent);
+    }
+    else
+    {
+        NAR_AddInput(yan->nar, term, EVENT_TYPE_BELIEF, truth, !isEvent);
+    }
+    return true;
+}
+
+void YAN_Cycles(YAN *yan, int cycles)
+{
+    NAR_Cycles(yan->nar, cycles);
+}
+
+long YAN_Time(YAN *yan)
+{
+    return yan->nar->currentTime;
+}
+
+bool YAN_AddOperation(YAN *yan, const char *operation, YAN_Operation callback, void *userdata)
+{
+    Term term;
+    char name[ATOMIC_TERM_LEN_MAX];
+    if(operation[0] != '^' || strlen(operation) >= ATOMIC_TERM_LEN_MAX || callback == NULL)
+    {
+        return false;
+    }
+    strcpy(name, operation);
+    if(!Narsese_ParseTerm(name, &term) || term.atoms[1] != 0)
+    {
+        return false; //not an atomic term
+    }
+    int id = Narsese_OperatorIndex(Narsese_atomNames[(int) term.atoms[0]-1]);
+    if(id > yan->operationsAmount)
+    {
+        YAN_Callback *operations = realloc(yan->operations, id * sizeof(YAN_Callback));
+        if(operations == NULL)
+        {
+            return false;
+        }
+        memset(&operations[yan->operationsAmount], 0, (id - yan->operationsAmount) * sizeof(YAN_Callback));
+        yan->operations = operations;
+        yan->operationsAmount = id;
+    }
+    yan->operations[id-1] = (YAN_Callback) { .callback = callback, .userdata = userdata, .term = term };
+    NAR_AddOperation(yan->nar, term, YAN_OperationInvoked);
+    return true;
+}
+
+int YAN_Ask(YAN *yan, const char *question, YAN_Answer *answer)
+{
+    Term term;
+    Truth truth;
+    char punctuation;
+    bool isEvent;
+    if(!YAN_Parse(question, &term, &punctuation, &isEvent, &truth) || punctuation != '?')
+    {
+        return YAN_MALFORMED;
+    }
+    Answer best = Query_Ask(yan->nar, &term, isEvent, yan->nar->currentTime);
+    if(best.term.atoms[0] == 0)
+    {
+        return YAN_UNANSWERED;
+    }
+    Narsese_SprintTerm(&best.term, answer->term, YAN_TERM_LEN_MAX);
+    answer->isEvent = best.occurrenceTime != OCCURRENCE_ETERNAL;
+    answer->occurrenceTime = best.occurrenceTime;
+    answer->creationTime = best.creationTime;
+    answer->frequency = Truth_Frequency(best.truth);
+    answer->confidence = Truth_Confidence(best.truth);
+    return YAN_ANSWERED;
+}
+
+bool YAN_NextDerivation(YAN *yan, YAN_Knowledge *derivation)
+{
+    if(yan->derivationsTail == yan->derivationsHead)
+    {
+        return false;
+    }
+    YAN_Derivation *d = &yan->derivations[yan->derivationsTail % YAN_DERIVATIONS_MAX];
+    Narsese_SprintTerm(&d->term, derivation->term, YAN_TERM_LEN_MAX);
+    derivation->punctuation = d->type == EVENT_TYPE_GOAL ? '!' : '.';
+    derivation->isEvent = d->occurrenceTime != OCCURRENCE_ETERNAL;
+    derivation->occurrenceTime = d->occurrenceTime;
+    derivation->frequency = Truth_Frequency(d->truth);
+    derivation->confidence = Truth_Confidence(d->truth);
+    derivation->priority = d->priority;
+    derivation->flags = d->flags;
+    yan->derivationsTail++;
+    return true;
+}
+
+long YAN_DroppedDerivations(YAN *yan)
+{
+    return yan->derivationsDropped;
+}
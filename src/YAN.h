@@ -0,0 +1,123 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef YAN_H
+#define YAN_H
+
+/////////////////////
+//  Embedding API  //
+/////////////////////
+//Stable C API of libyan.a/libyan.so for embedding the reasoner in-process.
+//It only uses C types, the reasoner's headers are not needed to use it.
+//Usage:
+//    YAN_Init();
+//    YAN *yan = YAN_New();
+//    YAN_AddOperation(yan, "^left", onLeft, NULL);
+//    YAN_AddInput(yan, "<a --> b>.");
+//    YAN_Cycles(yan, 10);
+//    YAN_Answer answer;
+//    if(YAN_Ask(yan, "<a --> ?1>?", &answer) == YAN_ANSWERED) { ... }
+//    YAN_Knowledge derivation;
+//    while(YAN_NextDerivation(yan, &derivation)) { ... }
+//    YAN_Free(yan);
+//Each instance may be driven by its own thread, a single instance must not be used by several threads at once.
+//Failed internal assertions terminate the process, as in the executable.
+
+//References//
+//-----------//
+#include <stdbool.h>
+
+//Parameters//
+//----------//
+//Maximum length of a term string including the terminating zero, the length of the longest printed term
+#define YAN_TERM_LEN_MAX 2177
+//Amount of derivations buffered for YAN_NextDerivation per instance, the oldest are dropped when it's full
+#define YAN_DERIVATIONS_MAX 4096
+//Flags of knowledge
+#define YAN_INPUT 1
+#define YAN_DERIVED 2
+#define YAN_REVISED 4
+#define YAN_IMPLICATION 8
+//Results of YAN_Ask
+#define YAN_ANSWERED 1
+#define YAN_UNANSWERED 0
+#define YAN_MALFORMED -1
+
+//Data structure//
+//--------------//
+//Reasoner instance handle
+typedef struct YAN YAN;
+//Knowledge added to memory
+typedef struct
+{
+    char term[YAN_TERM_LEN_MAX];
+    char punctuation; //'.' for beliefs, '!' for goals
+    bool isEvent;
+    long occurrenceTime; //only meaningful for events
+    double frequency;
+    double confidence;
+    double priority;
+    int flags; //YAN_INPUT, YAN_DERIVED, YAN_REVISED and YAN_IMPLICATION
+} YAN_Knowledge;
+//Answer to a question
+typedef struct
+{
+    char term[YAN_TERM_LEN_MAX];
+    bool isEvent;
+    long occurrenceTime; //only meaningful for events
+    long creationTime;
+    double frequency;
+    double confidence;
+} YAN_Answer;
+//Operation callback, args is the Narsese of the arguments and empty for atomic operations.
+//It's invoked during cycles and may add input to the instance.
+typedef void (*YAN_Operation)(YAN *yan, const char *operation, const char *args, void *userdata);
+
+//Methods//
+//-------//
+//Initializes the library, to be called once before creating instances, it resets the vocabulary shared by all instances
+//and switches the reasoner's printing off, as results are received through the API
+void YAN_Init();
+//Creates an instance
+YAN *YAN_New();
+//Frees an instance
+void YAN_Free(YAN *yan);
+//Resets the memory of the instance, keeping its operations
+void YAN_Reset(YAN *yan);
+//Adds a belief or goal in Narsese and performs a cycle, returns false if malformed or a question
+bool YAN_AddInput(YAN *yan, const char *narsese);
+//Performs inference cycles
+void YAN_Cycles(YAN *yan, int cycles);
+//Current time of the instance in cycles
+long YAN_Time(YAN *yan);
+//Registers the callback of an operation, the name has to start with ^, returns false if it can't be registered
+bool YAN_AddOperation(YAN *yan, const char *operation, YAN_Operation callback, void *userdata);
+//Answers a question in Narsese, returns YAN_ANSWERED, YAN_UNANSWERED or YAN_MALFORMED
+int YAN_Ask(YAN *yan, const char *question, YAN_Answer *answer);
+//Takes the oldest buffered added knowledge, returns false if there is none
+bool YAN_NextDerivation(YAN *yan, YAN_Knowledge *derivation);
+//Amount of derivations which were dropped as the buffer was full
+long YAN_DroppedDerivations(YAN *yan);
+
+#endif
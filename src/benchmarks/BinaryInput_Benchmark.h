@@ -0,0 +1,112 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define BINARY_INPUT_BENCHMARK_EVENTS 50000
+#define BINARY_INPUT_BENCHMARK_CYCLED_EVENTS 200
+
+//Decodes the text or binary stream, adding the first cycled events to the NAR, returns the decoded event amount
+static int BinaryInput_Benchmark_Run(NAR *nar, FILE *stream, bool binary, int cycled)
+{
+    rewind(stream);
+    int n = 0;
+    char line[NARSESE_LEN_MAX];
+    BinaryInput_Frame frame;
+    while(binary ? BinaryInput_ReadFrame(stream, &frame) : fgets(line, NARSESE_LEN_MAX, stream) != NULL)
+    {
+        if(!binary)
+        {
+            line[strcspn(line, "\n")] = 0;
+            assert(Narsese_Sentence(line, &frame.term, &frame.punctuation, &frame.isEvent, &frame.truth), "Benchmark sentence should parse");
+            frame.type = 'E';
+        }
+        if(n++ < cycled)
+        {
+            BinaryInput_ApplyFrame(nar, &frame);
+        }
+    }
+    return n;
+}
+
+void BinaryInput_Benchmark()
+{
+    puts(">>BinaryInput benchmark start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    BinaryInput_INIT();
+    bool printDerivations = PRINT_DERIVATIONS, printInput = PRINT_INPUT;
+    PRINT_DERIVATIONS = PRINT_INPUT = false;
+    bool registered[BINARY_INPUT_CLIENT_IDS_MAX] = {0};
+    FILE *text = tmpfile(), *binary = tmpfile();
+    for(int i=0; i<BINARY_INPUT_BENCHMARK_EVENTS; i++)
+    {
+        char line[NARSESE_LEN_MAX];
+        sprintf(line, "<{sensor%d} --> [value%d]>. :|: {%.2f 0.90}", i % 16, (i / 16) % 8, (i % 100) / 100.0);
+        fprintf(text, "%s\n", line);
+        Term term;
+        char punctuation;
+        bool isEvent;
+        Truth tv;
+        assert(Narsese_Sentence(line, &term, &punctuation, &isEvent, &tv), "Benchmark sentence should parse");
+        //the atom indices are used as client IDs, registered once:
+        for(int j=0; j<COMPOUND_TERM_SIZE_MAX; j++)
+        {
+            int atom = (uint8_t) term.atoms[j];
+            if(atom && !registered[atom])
+            {
+                registered[atom] = true;
+                BinaryInput_WriteRegistration(binary, atom, Narsese_atomNames[atom-1]);
+            }
+        }
+        BinaryInput_WriteEvent(binary, &term, punctuation, isEvent, tv);
+    }
+    double start = Benchmark_Seconds();
+    int n = BinaryInput_Benchmark_Run(nar, text, false, 0);
+    double textDecode = Benchmark_Seconds() - start;
+    printf("text decode: %d events in %f s, %.0f events/s\n", n, textDecode, n / textDecode);
+    start = Benchmark_Seconds();
+    n = BinaryInput_Benchmark_Run(nar, binary, true, 0);
+    double binaryDecode = Benchmark_Seconds() - start;
+    printf("binary decode: %d events in %f s, %.0f events/s\n", n, binaryDecode, n / binaryDecode);
+    //the first run warms up the memory, the measured runs follow
+    for(int run=0; run<3; run++)
+    {
+        bool binaryRun = run == 2;
+        NAR_INIT(nar);
+        BinaryInput_INIT();
+        start = Benchmark_Seconds();
+        BinaryInput_Benchmark_Run(nar, binaryRun ? binary : text, binaryRun, BINARY_INPUT_BENCHMARK_CYCLED_EVENTS);
+        double end2end = Benchmark_Seconds() - start;
+        if(run > 0)
+        {
+            printf("%s input with NAR_AddInput: %d events in %f s, %.0f events/s\n", binaryRun ? "binary" : "text", BINARY_INPUT_BENCHMARK_CYCLED_EVENTS, 
+                   end2end, BINARY_INPUT_BENCHMARK_CYCLED_EVENTS / end2end);
+        }
+    }
+    fclose(text);
+    fclose(binary);
+    PRINT_DERIVATIONS = printDerivations;
+    PRINT_INPUT = printInput;
+    puts(">>BinaryInput benchmark successful");
+    NAR_Free(nar);
+}
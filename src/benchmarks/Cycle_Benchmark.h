@@ -0,0 +1,94 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define CYCLE_BENCHMARK_CYCLES 200
+#define CYCLE_BENCHMARK_IDLE_CYCLES 100000
+
+static NAR *Cycle_Benchmark_FullMemory()
+{
+    NAR *nar = NAR_New();
+    for(int i=0; i<CONCEPTS_MAX; i++)
+    {
+        char narsese[NARSESE_LEN_MAX];
+        sprintf(narsese, "<(%c * %c) --> %c>", 'a' + i % 26, 'a' + (i / 26) % 26, 'a' + i / (26*26));
+        Term term = Narsese_Term(narsese);
+        Memory_Conceptualize(nar, &term, nar->currentTime);
+    }
+    assert(nar->concepts.itemsAmount == CONCEPTS_MAX, "The concept memory should be full");
+    return nar;
+}
+
+//The sweeps of a cycle over a full concept memory: matching a goal, decision making, forgetting and clearing the spikes,
+//and the matching of a selected belief event with all concepts in the inference loop
+void Cycle_Benchmark()
+{
+    puts(">>Cycle benchmark start");
+    Narsese_INIT();
+    bool printDerivations = PRINT_DERIVATIONS, printInput = PRINT_INPUT;
+    PRINT_DERIVATIONS = PRINT_INPUT = false;
+    double motorBabbling = MOTOR_BABBLING_CHANCE;
+    MOTOR_BABBLING_CHANCE = 0;
+    NAR *nar = Cycle_Benchmark_FullMemory();
+    Term goal = Narsese_Term("<(b * b) --> a>");
+    double start = Benchmark_Seconds();
+    for(int i=0; i<CYCLE_BENCHMARK_CYCLES; i++)
+    {
+        NAR_AddInputGoal(nar, goal);
+    }
+    double elapsed = Benchmark_Seconds() - start;
+    printf("Cycle with %d concepts: %.1f us/cycle\n", CONCEPTS_MAX, elapsed / CYCLE_BENCHMARK_CYCLES * 1e6);
+    NAR_Free(nar);
+    nar = Cycle_Benchmark_FullMemory();
+    Term belief = Narsese_Term("<(b * b) --> a>");
+    start = Benchmark_Seconds();
+    for(int i=0; i<CYCLE_BENCHMARK_CYCLES; i++)
+    {
+        for(int j=0; j<CONCEPTS_MAX; j++)
+        {
+            nar->concept_priority[j] = 1.0; //all concepts pass the priority filter of the inference loop
+        }
+        NAR_AddInputBelief(nar, belief);
+    }
+    elapsed = Benchmark_Seconds() - start;
+    printf("Inference with %d concepts: %.1f us/cycle\n", CONCEPTS_MAX, elapsed / CYCLE_BENCHMARK_CYCLES * 1e6);
+    NAR_Free(nar);
+    //idle cycles, performed one by one and skipped at once
+    nar = Cycle_Benchmark_FullMemory();
+    bool fastForward = CYCLE_FAST_FORWARD;
+    CYCLE_FAST_FORWARD = false;
+    start = Benchmark_Seconds();
+    NAR_Cycles(nar, CYCLE_BENCHMARK_CYCLES);
+    elapsed = Benchmark_Seconds() - start;
+    CYCLE_FAST_FORWARD = true;
+    start = Benchmark_Seconds();
+    NAR_Cycles(nar, CYCLE_BENCHMARK_IDLE_CYCLES);
+    double skipped = Benchmark_Seconds() - start;
+    CYCLE_FAST_FORWARD = fastForward;
+    printf("Idle cycles with %d concepts: %.1f us/cycle, skipped %.4f us/cycle\n", CONCEPTS_MAX,
+           elapsed / CYCLE_BENCHMARK_CYCLES * 1e6, skipped / CYCLE_BENCHMARK_IDLE_CYCLES * 1e6);
+    NAR_Free(nar);
+    MOTOR_BABBLING_CHANCE = motorBabbling;
+    PRINT_DERIVATIONS = printDerivations; PRINT_INPUT = printInput;
+    puts(">>Cycle benchmark successful");
+}
@@ -0,0 +1,77 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define EVENT_BAG_BENCHMARK_SIZE_MAX 100000
+
+//Distinct events for the bag, it only looks at the terms and truth values
+static Event EventBag_Benchmark_Event(int i)
+{
+    Event e = { .type = EVENT_TYPE_BELIEF, .truth = Truth_New(1.0, 0.9) };
+    e.term.atoms[0] = 1 + i % 127;
+    e.term.atoms[1] = 1 + (i / 127) % 127;
+    e.term.atoms[2] = 1 + (i / (127*127)) % 127;
+    return e;
+}
+
+void EventBag_Benchmark()
+{
+    puts(">>EventBag benchmark start");
+    EventBag_Item *items = malloc(EVENT_BAG_BENCHMARK_SIZE_MAX * sizeof(EventBag_Item));
+    int *buckets = malloc(2 * EVENT_BAG_BENCHMARK_SIZE_MAX * sizeof(int));
+    EventBag bag;
+    for(int size=1000; size<=EVENT_BAG_BENCHMARK_SIZE_MAX; size*=10)
+    {
+        EventBag_RESET(&bag, items, size, buckets, 2*size);
+        //fill the bag, checking for duplicates as the memory does
+        double start = Benchmark_Seconds();
+        for(int i=0; i<size; i++)
+        {
+            Event e = EventBag_Benchmark_Event(i);
+            if(!EventBag_Contains(&bag, &e))
+            {
+                EventBag_Add(&bag, &e, (i % 1000) / 1000.0);
+            }
+        }
+        double fill = Benchmark_Seconds() - start;
+        //steady state of the cycles: select an event and add a derived one
+        start = Benchmark_Seconds();
+        for(int i=0; i<size; i++)
+        {
+            Event e;
+            double priority;
+            EventBag_PopMax(&bag, &e, &priority);
+            Event derived = EventBag_Benchmark_Event(size + i);
+            if(!EventBag_Contains(&bag, &derived))
+            {
+                EventBag_Add(&bag, &derived, priority * 0.9);
+            }
+        }
+        double cycle = Benchmark_Seconds() - start;
+        assert(bag.itemsAmount == size, "The bag should have stayed full");
+        printf("EventBag %d events: add %.0f ns/event, select and add %.0f ns/event\n", size, fill / size * 1e9, cycle / size * 1e9);
+    }
+    free(items);
+    free(buckets);
+    puts(">>EventBag benchmark successful");
+}
@@ -0,0 +1,68 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define NARSESE_BENCHMARK_REPETITIONS 20000
+
+void Narsese_Benchmark()
+{
+    puts(">>Narsese benchmark start");
+    char *lines[] = { "<<$1 --> (&,[furry,meowing],animal)> =/> <$1 --> [good]>>. {1.0 0.9}",
+                      "<(&/,<a --> b>,<(* {SELF}) --> ^left>) =/> <c --> [d]>>.",
+                      "<(<cat --> animal> &/ ^pick) =/> <cat --> [held]>>! :|:",
+                      "(&/,<ball --> [left]>,^left)? :|:",
+                      "<{tim} --> (/,livingIn,_,{graz})>. :|: {0.8 0.9}" };
+    int n_lines = sizeof(lines) / sizeof(lines[0]);
+    Term terms[sizeof(lines) / sizeof(lines[0])];
+    int n = NARSESE_BENCHMARK_REPETITIONS * n_lines;
+    //serial throughput:
+    double start = Benchmark_Seconds();
+    for(int i=0; i<n; i++)
+    {
+        char punctuation;
+        bool isEvent;
+        Truth tv;
+        assert(Narsese_Sentence(lines[i % n_lines], &terms[i % n_lines], &punctuation, &isEvent, &tv), "Benchmark sentence should parse");
+    }
+    double serial = Benchmark_Seconds() - start;
+    printf("Narsese_Sentence serial: %d lines in %f s, %.0f lines/s\n", n, serial, n / serial);
+    //parallel throughput, the parser is reentrant:
+    int mismatches = 0;
+    start = Benchmark_Seconds();
+    #pragma omp parallel for reduction(+:mismatches)
+    for(int i=0; i<n; i++)
+    {
+        Term term;
+        char punctuation;
+        bool isEvent;
+        Truth tv;
+        if(!Narsese_Sentence(lines[i % n_lines], &term, &punctuation, &isEvent, &tv) || !Term_Equal(&term, &terms[i % n_lines]))
+        {
+            mismatches++;
+        }
+    }
+    double parallel = Benchmark_Seconds() - start;
+    assert(mismatches == 0, "Parallel parsing has to give the same terms");
+    printf("Narsese_Sentence parallel: %d lines in %f s, %.0f lines/s\n", n, parallel, n / parallel);
+    puts(">>Narsese benchmark successful");
+}
@@ -0,0 +1,76 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define PRIORITY_QUEUE_BENCHMARK_ITEMS 100000
+
+void PriorityQueue_Benchmark()
+{
+    puts(">>PriorityQueue benchmark start");
+    int n = PRIORITY_QUEUE_BENCHMARK_ITEMS;
+    Item *items = malloc(n * sizeof(Item));
+    int *slots = malloc(n * sizeof(int));
+    double *priorities = malloc(n * sizeof(double));
+    void **addresses = malloc(n * sizeof(void*));
+    PriorityQueue queue;
+    PriorityQueue_RESET(&queue, items, slots, n);
+    srand(42);
+    for(int i=0; i<n; i++)
+    {
+        priorities[i] = rand() / (double) RAND_MAX;
+    }
+    double start = Benchmark_Seconds();
+    for(int i=0; i<n; i++)
+    {
+        PriorityQueue_Push(&queue, priorities[i]);
+    }
+    double push = Benchmark_Seconds() - start;
+    //the forgetting of the cycle: all priorities change, followed by a rebuild
+    start = Benchmark_Seconds();
+    for(int i=0; i<n; i++)
+    {
+        queue.items[i].priority *= 0.5 + 0.5 * priorities[(i * 7) % n];
+    }
+    PriorityQueue_Rebuild(&queue);
+    double rebuild = Benchmark_Seconds() - start;
+    start = Benchmark_Seconds();
+    for(int i=0; i<n; i++)
+    {
+        PriorityQueue_Update(&queue, PriorityQueue_IndexOf(&queue, (i * 7919) % n), priorities[i]);
+    }
+    double update = Benchmark_Seconds() - start;
+    start = Benchmark_Seconds();
+    int popped = PriorityQueue_PopMaxBatch(&queue, n, addresses, NULL);
+    double pop = Benchmark_Seconds() - start;
+    start = Benchmark_Seconds();
+    PriorityQueue_PushBatch(&queue, priorities, n, NULL);
+    double pushBatch = Benchmark_Seconds() - start;
+    assert(popped == n && queue.itemsAmount == n, "All items should have been popped and pushed again");
+    printf("PriorityQueue %d items: push %.0f ns/item, batched push %.0f ns/item, rebuild %.0f ns/item, update %.0f ns/item, pop max %.0f ns/item\n",
+           n, push / n * 1e9, pushBatch / n * 1e9, rebuild / n * 1e9, update / n * 1e9, pop / n * 1e9);
+    free(items);
+    free(slots);
+    free(priorities);
+    free(addresses);
+    puts(">>PriorityQueue benchmark successful");
+}
@@ -0,0 +1,61 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define STAMP_BENCHMARK_STAMPS 1024
+#define STAMP_BENCHMARK_PAIRS 1000000
+
+//Overlap checks and zipping of the stamps of derivations, built from consecutive input bases as in the inference loop
+void Stamp_Benchmark()
+{
+    puts(">>Stamp benchmark start");
+    static Stamp stamps[STAMP_BENCHMARK_STAMPS];
+    long base = 1;
+    for(int i=0; i<STAMP_BENCHMARK_STAMPS; i++)
+    {
+        stamps[i] = Stamp_new(base++);
+        for(int j=0; j<i%STAMP_SIZE; j++)
+        {
+            Stamp input = Stamp_new(base++);
+            stamps[i] = Stamp_make(&stamps[i], &input);
+        }
+    }
+    int overlaps = 0;
+    double start = Benchmark_Seconds();
+    for(int i=0; i<STAMP_BENCHMARK_PAIRS; i++)
+    {
+        overlaps += Stamp_checkOverlap(&stamps[i % STAMP_BENCHMARK_STAMPS], &stamps[(i*7+1) % STAMP_BENCHMARK_STAMPS]);
+    }
+    double check = Benchmark_Seconds() - start;
+    long checksum = 0;
+    start = Benchmark_Seconds();
+    for(int i=0; i<STAMP_BENCHMARK_PAIRS; i++)
+    {
+        Stamp zipped = Stamp_make(&stamps[i % STAMP_BENCHMARK_STAMPS], &stamps[(i*7+1) % STAMP_BENCHMARK_STAMPS]);
+        checksum += zipped.evidentalBase[STAMP_SIZE-1];
+    }
+    double make = Benchmark_Seconds() - start;
+    printf("Stamp: overlap check %.1f ns/pair (%d overlapping), make %.1f ns/pair (checksum %ld), size %d bytes\n",
+           check / STAMP_BENCHMARK_PAIRS * 1e9, overlaps, make / STAMP_BENCHMARK_PAIRS * 1e9, checksum, (int) sizeof(Stamp));
+    puts(">>Stamp benchmark successful");
+}
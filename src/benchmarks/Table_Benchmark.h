@@ -0,0 +1,58 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define TABLE_BENCHMARK_TERMS (TABLE_SIZE*4)
+#define TABLE_BENCHMARK_ADDITIONS 200000
+
+//Revision and ranking of implications with more distinct terms than fit into the table, as in temporal induction
+void Table_Benchmark()
+{
+    puts(">>Table benchmark start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    Concept sourceConcept = {0};
+    static Implication imps[TABLE_BENCHMARK_TERMS];
+    for(int i=0; i<TABLE_BENCHMARK_TERMS; i++)
+    {
+        char narsese[NARSESE_LEN_MAX];
+        sprintf(narsese, "<(a%d &/ ^left) =/> b>", i);
+        imps[i] = (Implication) { .term = Narsese_Term(narsese), .truth = Truth_New(1.0, 0.1 + 0.8 * (i % 7) / 7.0), .sourceConcept = &sourceConcept };
+    }
+    static Table table;
+    table = (Table) {0};
+    long checksum = 0;
+    double start = Benchmark_Seconds();
+    for(int i=0; i<TABLE_BENCHMARK_ADDITIONS; i++)
+    {
+        Implication imp = imps[(i*7) % TABLE_BENCHMARK_TERMS];
+        imp.stamp = Stamp_new(i+1);
+        Implication *added = Table_AddAndRevise(nar, &table, &imp);
+        checksum += added != NULL;
+    }
+    double elapsed = Benchmark_Seconds() - start;
+    printf("Table of %d implications: add and revise %.1f ns/implication (%ld kept), size %d bytes\n",
+           TABLE_SIZE, elapsed / TABLE_BENCHMARK_ADDITIONS * 1e9, checksum, (int) sizeof(Table));
+    NAR_Free(nar);
+    puts(">>Table benchmark successful");
+}
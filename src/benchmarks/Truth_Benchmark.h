@@ -0,0 +1,86 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#define TRUTH_BENCHMARK_ROUNDS 100000
+
+static const char *Truth_Benchmark_Profile()
+{
+    return NUMERIC_PROFILE == NUMERIC_FIXED16 ? "fixed16" : NUMERIC_PROFILE == NUMERIC_FLOAT ? "float" : "double";
+}
+
+//Scoring of decision candidates by projection, deduction and expectation, computing the decay each time, with the decay table and in batches
+void Truth_Benchmark()
+{
+    puts(">>Truth benchmark start");
+    printf("Truth: numeric profile %s, Truth %d bytes, Event %d bytes, Implication %d bytes, Concept %d bytes, NAR %d bytes\n", Truth_Benchmark_Profile(),
+           (int) sizeof(Truth), (int) sizeof(Event), (int) sizeof(Implication), (int) sizeof(Concept), (int) sizeof(NAR));
+    Truth imps[TRUTH_BATCH_SIZE], goals[TRUTH_BATCH_SIZE], preconditions[TRUTH_BATCH_SIZE];
+    long times[TRUTH_BATCH_SIZE];
+    for(int i=0; i<TRUTH_BATCH_SIZE; i++)
+    {
+        imps[i] = Truth_New(0.5 + (i % 5) / 10.0, 0.3 + (i % 6) / 10.0);
+        goals[i] = Truth_New(1.0, 0.9);
+        preconditions[i] = Truth_New(1.0, 0.9);
+        times[i] = i % 20;
+    }
+    double sum = 0.0;
+    double start = Benchmark_Seconds();
+    for(int r=0; r<TRUTH_BENCHMARK_ROUNDS; r++)
+    {
+        for(int i=0; i<TRUTH_BATCH_SIZE; i++)
+        {
+            Truth precondition = preconditions[i];
+            precondition.confidence *= pow(TRUTH_PROJECTION_DECAY, labs(r % 20 - times[i]));
+            sum += Truth_Expectation(Truth_Deduction(Truth_Deduction(imps[i], goals[i]), precondition));
+        }
+    }
+    double computed = Benchmark_Seconds() - start;
+    start = Benchmark_Seconds();
+    for(int r=0; r<TRUTH_BENCHMARK_ROUNDS; r++)
+    {
+        for(int i=0; i<TRUTH_BATCH_SIZE; i++)
+        {
+            sum += Truth_Expectation(Truth_Deduction(Truth_Deduction(imps[i], goals[i]), Truth_Projection(preconditions[i], times[i], r % 20)));
+        }
+    }
+    double tabulated = Benchmark_Seconds() - start;
+    Truth contextual[TRUTH_BATCH_SIZE], projected[TRUTH_BATCH_SIZE], desired[TRUTH_BATCH_SIZE];
+    double expectations[TRUTH_BATCH_SIZE];
+    start = Benchmark_Seconds();
+    for(int r=0; r<TRUTH_BENCHMARK_ROUNDS; r++)
+    {
+        Truth_DeductionBatch(imps, goals, contextual, TRUTH_BATCH_SIZE);
+        Truth_ProjectionBatch(preconditions, times, r % 20, projected, TRUTH_BATCH_SIZE);
+        Truth_DeductionBatch(contextual, projected, desired, TRUTH_BATCH_SIZE);
+        Truth_ExpectationBatch(desired, expectations, TRUTH_BATCH_SIZE);
+        for(int i=0; i<TRUTH_BATCH_SIZE; i++)
+        {
+            sum += expectations[i];
+        }
+    }
+    double batched = Benchmark_Seconds() - start;
+    double candidates = (double) TRUTH_BENCHMARK_ROUNDS * TRUTH_BATCH_SIZE;
+    printf("Truth: candidate scoring with pow %.1f ns, with decay table %.1f ns, batched %.1f ns (checksum %f)\n",
+           computed / candidates * 1e9, tabulated / candidates * 1e9, batched / candidates * 1e9, sum);
+    puts(">>Truth benchmark successful");
+}
@@ -22,24 +22,33 @@
  * THE SOFTWARE.
  */
 
-#include "Stack.h"
+#include <time.h>
 
-void Stack_Push(Stack *stack, VMItem *item)
+//Monotonic wall clock time in seconds for measuring throughput
+static double Benchmark_Seconds()
 {
-    stack->items[stack->stackpointer] = item;
-    stack->stackpointer++;
-    assert(stack->stackpointer <= CONCEPTS_MAX, "VMEntry stack overflow");
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
 }
 
-VMItem *Stack_Pop(Stack *stack)
-{
-    stack->stackpointer--;
-    assert(stack->stackpointer >= 0, "VMEntry stack underflow");
-    return stack->items[stack->stackpointer];
-}
+#include "Narsese_Benchmark.h"
+#include "BinaryInput_Benchmark.h"
+#include "EventBag_Benchmark.h"
+#include "PriorityQueue_Benchmark.h"
+#include "Cycle_Benchmark.h"
+#include "Stamp_Benchmark.h"
+#include "Truth_Benchmark.h"
+#include "Table_Benchmark.h"
 
-bool Stack_IsEmpty(Stack *stack)
+void Run_Benchmarks()
 {
-    return stack->stackpointer == 0;
+    Narsese_Benchmark();
+    BinaryInput_Benchmark();
+    EventBag_Benchmark();
+    PriorityQueue_Benchmark();
+    Cycle_Benchmark();
+    Stamp_Benchmark();
+    Truth_Benchmark();
+    Table_Benchmark();
 }
-
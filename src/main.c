@@ -28,8 +28,14 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include "NAR.h"
+#include "BinaryInput.h"
+#include "YAN.h"
+#include "Runner.h"
+#include "Planner.h"
+#include <sched.h>
 #include "./unit_tests/unit_tests.h"
 #include "./system_tests/system_tests.h"
+#include "./benchmarks/benchmarks.h"
 #include "Shell.h"
 
 void Process_Args(int argc, char *argv[])
@@ -43,7 +49,6 @@ void Process_Args(int argc, char *argv[])
     {
         if(!strcmp(argv[1],"NAL_GenerateRuleTable"))
         {
-            NAR_INIT();
             NAL_GenerateRuleTable();
             exit(0);
         }
@@ -67,6 +72,18 @@ void Process_Args(int argc, char *argv[])
         {
             Shell_Start();
         }
+        if(!strcmp(argv[1],"binary"))
+        {
+            NAR *nar = NAR_New();
+            Shell_NARInit(nar);
+            BinaryInput_Start(nar);
+            exit(0);
+        }
+        if(!strcmp(argv[1],"bench"))
+        {
+            Run_Benchmarks();
+            exit(0);
+        }
     }
 }
 
@@ -78,13 +95,16 @@ void Display_Help()
     puts("YAN testchamber (starts Test Chamber multistep procedure learning example)");
     puts("YAN alien (starts the alien example)");
     puts("YAN shell (starts the interactive NAL shell)");
+    puts("YAN binary (starts the NAL shell with binary event input)");
+    puts("YAN bench (runs the throughput benchmarks)");
 }
 
 int main(int argc, char *argv[])
 {
     srand(1337);
+    Truth_INIT();
+    Narsese_INIT();
     Process_Args(argc, argv);
-    NAR_INIT();
     Run_Unit_Tests();
     Run_System_Tests();
     Display_Help();
@@ -42,11 +42,12 @@ void NAR_Alien_Shoot()
 }
 void NAR_Alien(long iterations)
 {
-    NAR_INIT();
+    Narsese_INIT();
+    NAR *nar = NAR_New();
     puts(">>NAR Alien1 start");
-    NAR_AddOperation(Narsese_Term("^left"), NAR_Alien_Left); 
-    NAR_AddOperation(Narsese_Term("^right"), NAR_Alien_Right); 
-    NAR_AddOperation(Narsese_Term("^shoot"), NAR_Alien_Shoot); 
+    NAR_AddOperation(nar, Narsese_Term("^left"), NAR_Alien_Left); 
+    NAR_AddOperation(nar, Narsese_Term("^right"), NAR_Alien_Right); 
+    NAR_AddOperation(nar, Narsese_Term("^shoot"), NAR_Alien_Shoot); 
     double alien0X = 0.5;
     double defenderX = 0.5;
     double alienWidth = 0.18;
@@ -68,17 +69,17 @@ void NAR_Alien(long iterations)
         bool cond2 = (defenderX >  alien0X + alienWidth);
         if(cond1)
         {
-            NAR_AddInputBelief(Narsese_Term("r0"));
+            NAR_AddInputBelief(nar, Narsese_Term("r0"));
         }
         else if(cond2)
         {
-            NAR_AddInputBelief(Narsese_Term("l0"));
+            NAR_AddInputBelief(nar, Narsese_Term("l0"));
         }
         else
         {
-            NAR_AddInputBelief(Narsese_Term("c0"));
+            NAR_AddInputBelief(nar, Narsese_Term("c0"));
         }
-        NAR_AddInputGoal(Narsese_Term("s0"));
+        NAR_AddInputGoal(nar, Narsese_Term("s0"));
         if(NAR_Alien_Shoot_executed)
         {
             NAR_Alien_Shoot_executed = false;
@@ -86,7 +87,7 @@ void NAR_Alien(long iterations)
             if(!cond1 && !cond2)
             {
                 hits++;
-                NAR_AddInputBelief(Narsese_Term("s0"));
+                NAR_AddInputBelief(nar, Narsese_Term("s0"));
                 alien0X = ((double)(rand() % 1000)) / 1000.0;
             }
         }
@@ -100,8 +101,9 @@ void NAR_Alien(long iterations)
             NAR_Alien_Right_executed = false;
             defenderX = MIN(1.0, defenderX+0.1);
         }
-        printf("shots=%d hits=%d ratio=%f time=%ld\n", shots, hits, (float) (((float) hits) / ((float) shots)), currentTime);
+        printf("shots=%d hits=%d ratio=%f time=%ld\n", shots, hits, (float) (((float) hits) / ((float) shots)), nar->currentTime);
         //nanosleep((struct timespec[]){{0, 10000000L}}, NULL); //POSIX sleep
-        //NAR_Cycles(10);
+        //NAR_Cycles(nar, 10);
     }
+    NAR_Free(nar);
 }
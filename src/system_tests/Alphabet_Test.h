@@ -24,19 +24,21 @@
 
 void NAR_Alphabet_Test()
 {
-    NAR_INIT();
+    Narsese_INIT();
+    NAR *nar = NAR_New();
     puts(">>NAR Alphabet test start");
-    NAR_AddInput(Narsese_AtomicTerm("a"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false);
+    NAR_AddInput(nar, Narsese_AtomicTerm("a"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false);
     for(int i=0; i<50; i++)
     {
         int k=i%10;
         if(i % 3 == 0)
         {
             char c[2] = {'a'+k,0};
-            NAR_AddInput(Narsese_AtomicTerm(c), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false);
+            NAR_AddInput(nar, Narsese_AtomicTerm(c), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false);
         }
-        NAR_Cycles(1);
+        NAR_Cycles(nar, 1);
         puts("TICK");
     }
     puts("<<NAR Alphabet test successful");
+    NAR_Free(nar);
 }
@@ -36,10 +36,11 @@ void NAR_Follow_Test_Right()
 }
 void NAR_Follow_Test()
 {
-    NAR_INIT();
+    Narsese_INIT();
+    NAR *nar = NAR_New();
     puts(">>NAR Follow test start");
-    NAR_AddOperation(Narsese_AtomicTerm("^left"), NAR_Follow_Test_Left); 
-    NAR_AddOperation(Narsese_AtomicTerm("^right"), NAR_Follow_Test_Right); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^left"), NAR_Follow_Test_Left); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^right"), NAR_Follow_Test_Right); 
     int simsteps = 1000000;
     int LEFT = 0;
     int RIGHT = 1;
@@ -50,13 +51,13 @@ void NAR_Follow_Test()
     for(int i=0;i<simsteps; i++)
     {
         puts(BALL == LEFT ? "LEFT" : "RIGHT");
-        NAR_AddInputBelief(BALL == LEFT ? Narsese_AtomicTerm("ball_left") : Narsese_AtomicTerm("ball_right"));
-        NAR_AddInputGoal(Narsese_AtomicTerm("good_yan"));
+        NAR_AddInputBelief(nar, BALL == LEFT ? Narsese_AtomicTerm("ball_left") : Narsese_AtomicTerm("ball_right"));
+        NAR_AddInputGoal(nar, Narsese_AtomicTerm("good_yan"));
         if(NAR_Follow_Test_Right_executed)
         {
             if(BALL == RIGHT)
             {
-                NAR_AddInputBelief(Narsese_AtomicTerm("good_yan"));
+                NAR_AddInputBelief(nar, Narsese_AtomicTerm("good_yan"));
                 printf("(ball=%d) good\n",BALL);
                 score++;
                 goods++;
@@ -73,7 +74,7 @@ void NAR_Follow_Test()
         {        
             if(BALL == LEFT)
             {
-                NAR_AddInputBelief(Narsese_AtomicTerm("good_yan"));
+                NAR_AddInputBelief(nar, Narsese_AtomicTerm("good_yan"));
                 printf("(ball=%d) good\n",BALL);
                 score++;
                 goods++;
@@ -92,7 +93,8 @@ void NAR_Follow_Test()
         assert(bads < 500, "too many wrong trials");
         if(score >= 500)
             break;
-        NAR_Cycles(10);
+        NAR_Cycles(nar, 10);
     }
     printf("<<NAR Follow test successful goods=%d bads=%d ratio=%f\n",goods,bads, (((float) goods)/(((float) goods) + ((float) bads))));
+    NAR_Free(nar);
 }
@@ -38,31 +38,33 @@ void NAR_Multistep_Test()
 {
     MOTOR_BABBLING_CHANCE = 0;
     puts(">>NAR Multistep test start");
-    NAR_INIT();
-    NAR_AddOperation(Narsese_AtomicTerm("^goto_switch"), NAR_Lightswitch_GotoSwitch); 
-    NAR_AddOperation(Narsese_AtomicTerm("^activate_switch"), NAR_Lightswitch_ActivateSwitch); 
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^goto_switch"), NAR_Lightswitch_GotoSwitch); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^activate_switch"), NAR_Lightswitch_ActivateSwitch); 
     for(int i=0; i<5; i++)
     {
-        NAR_AddInputBelief(Narsese_AtomicTerm("start_at"));
-        NAR_AddInputBelief(Narsese_AtomicTerm("^goto_switch"));
-        NAR_Cycles(1);
-        NAR_AddInputBelief(Narsese_AtomicTerm("switch_at"));
-        NAR_AddInputBelief(Narsese_AtomicTerm("^activate_switch"));
-        NAR_AddInputBelief(Narsese_AtomicTerm("switch_active"));
-        NAR_Cycles(1);
-        NAR_AddInputBelief(Narsese_AtomicTerm("light_active"));
-        NAR_Cycles(10);
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm("start_at"));
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm("^goto_switch"));
+        NAR_Cycles(nar, 1);
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm("switch_at"));
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm("^activate_switch"));
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm("switch_active"));
+        NAR_Cycles(nar, 1);
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm("light_active"));
+        NAR_Cycles(nar, 10);
     }
-    NAR_Cycles(10);
-    NAR_AddInputBelief(Narsese_AtomicTerm("start_at"));
-    NAR_AddInputGoal(Narsese_AtomicTerm("light_active"));
-    NAR_Cycles(10);
+    NAR_Cycles(nar, 10);
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("start_at"));
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("light_active"));
+    NAR_Cycles(nar, 10);
     assert(NAR_Lightswitch_GotoSwitch_executed && !NAR_Lightswitch_ActivateSwitch_executed, "NAR needs to go to the switch first");
     NAR_Lightswitch_GotoSwitch_executed = false;
     puts("NAR arrived at the switch");
-    NAR_AddInputBelief(Narsese_AtomicTerm("switch_at"));
-    NAR_AddInputGoal(Narsese_AtomicTerm("light_active"));
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("switch_at"));
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("light_active"));
     assert(!NAR_Lightswitch_GotoSwitch_executed && NAR_Lightswitch_ActivateSwitch_executed, "NAR needs to activate the switch");
     NAR_Lightswitch_ActivateSwitch_executed = false;
     puts("<<NAR Multistep test successful");
+    NAR_Free(nar);
 }
@@ -39,11 +39,12 @@ void NAR_Pong_Stop()
 }
 void NAR_Pong2(long iterations)
 {
-    NAR_INIT();
+    Narsese_INIT();
+    NAR *nar = NAR_New();
     puts(">>NAR Pong start");
-    NAR_AddOperation(Narsese_AtomicTerm("^left"), NAR_Pong_Left); 
-    NAR_AddOperation(Narsese_AtomicTerm("^right"), NAR_Pong_Right); 
-    NAR_AddOperation(Narsese_AtomicTerm("^stop"), NAR_Pong_Stop); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^left"), NAR_Pong_Left); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^right"), NAR_Pong_Right); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^stop"), NAR_Pong_Stop); 
     int szX = 50;
     int szY = 20;
     int ballX = szX/2;
@@ -103,18 +104,18 @@ void NAR_Pong2(long iterations)
         }
         if(batX <= ballX - batWidth)
         {
-            NAR_AddInputBelief(Narsese_AtomicTerm("ball_right"));
+            NAR_AddInputBelief(nar, Narsese_AtomicTerm("ball_right"));
         }
         else
         if(ballX + batWidth < batX)
         {
-            NAR_AddInputBelief(Narsese_AtomicTerm("ball_left"));
+            NAR_AddInputBelief(nar, Narsese_AtomicTerm("ball_left"));
         }
         else
         {
-            NAR_AddInputBelief(Narsese_AtomicTerm("ball_equal"));
+            NAR_AddInputBelief(nar, Narsese_AtomicTerm("ball_equal"));
         }
-        NAR_AddInputGoal(Narsese_AtomicTerm("good_yan"));
+        NAR_AddInputGoal(nar, Narsese_AtomicTerm("good_yan"));
         if(ballX <= 0)
         {
             vX = 1;
@@ -140,7 +141,7 @@ void NAR_Pong2(long iterations)
         {
             if(abs(ballX-batX) <= batWidth)
             {
-                NAR_AddInputBelief(Narsese_AtomicTerm("good_yan"));
+                NAR_AddInputBelief(nar, Narsese_AtomicTerm("good_yan"));
                 puts("good");
                 hits++;
             }
@@ -175,11 +176,12 @@ void NAR_Pong2(long iterations)
             batVX = 0;
         }
         batX=MAX(-batWidth*2,MIN(szX-1+batWidth,batX+batVX*batWidth/2));
-        printf("Hits=%d misses=%d ratio=%f time=%ld\n", hits, misses, (float) (((float) hits) / ((float) hits + misses)), currentTime);
+        printf("Hits=%d misses=%d ratio=%f time=%ld\n", hits, misses, (float) (((float) hits) / ((float) hits + misses)), nar->currentTime);
         if(iterations == -1)
         {
             nanosleep((struct timespec[]){{0, 20000000L}}, NULL); //POSIX sleep
         }
-        //NAR_Cycles(10);
+        //NAR_Cycles(nar, 10);
     }
+    NAR_Free(nar);
 }
@@ -24,10 +24,11 @@
 
 void NAR_Pong(long iterations)
 {
-    NAR_INIT();
+    Narsese_INIT();
+    NAR *nar = NAR_New();
     puts(">>NAR Pong start");
-    NAR_AddOperation(Narsese_AtomicTerm("^left"), NAR_Pong_Left); 
-    NAR_AddOperation(Narsese_AtomicTerm("^right"), NAR_Pong_Right); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^left"), NAR_Pong_Left); 
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^right"), NAR_Pong_Right); 
     int szX = 50;
     int szY = 20;
     int ballX = szX/2;
@@ -86,13 +87,13 @@ void NAR_Pong(long iterations)
         }
         if(batX < ballX)
         {
-            NAR_AddInputBelief(Narsese_AtomicTerm("ball_right"));
+            NAR_AddInputBelief(nar, Narsese_AtomicTerm("ball_right"));
         }
         if(ballX < batX)
         {
-            NAR_AddInputBelief(Narsese_AtomicTerm("ball_left"));
+            NAR_AddInputBelief(nar, Narsese_AtomicTerm("ball_left"));
         }
-        NAR_AddInputGoal(Narsese_AtomicTerm("good_yan"));
+        NAR_AddInputGoal(nar, Narsese_AtomicTerm("good_yan"));
         if(ballX <= 0)
         {
             vX = 1;
@@ -115,7 +116,7 @@ void NAR_Pong(long iterations)
         {
             if(abs(ballX-batX) <= batWidth)
             {
-                NAR_AddInputBelief(Narsese_AtomicTerm("good_yan"));
+                NAR_AddInputBelief(nar, Narsese_AtomicTerm("good_yan"));
                 puts("good");
                 hits++;
             }
@@ -144,11 +145,12 @@ void NAR_Pong(long iterations)
             batVX = 2;
         }
         batX=MAX(0,MIN(szX-1,batX+batVX*batWidth/2));
-        printf("Hits=%d misses=%d ratio=%f time=%ld\n", hits, misses, (float) (((float) hits) / ((float) hits + misses)), currentTime);
+        printf("Hits=%d misses=%d ratio=%f time=%ld\n", hits, misses, (float) (((float) hits) / ((float) hits + misses)), nar->currentTime);
         if(iterations == -1)
         {
             nanosleep((struct timespec[]){{0, 20000000L}}, NULL); //POSIX sleep
         }
-        //NAR_Cycles(10);
+        //NAR_Cycles(nar, 10);
     }
+    NAR_Free(nar);
 }
@@ -30,24 +30,26 @@ void NAR_Procedure_Test_Op()
 }
 void NAR_Procedure_Test()
 {
-    NAR_INIT();
+    Narsese_INIT();
+    NAR *nar = NAR_New();
     puts(">>NAR Procedure test start");
-    NAR_AddOperation(Narsese_AtomicTerm("^op"), NAR_Procedure_Test_Op); 
-    NAR_AddInputBelief(Narsese_AtomicTerm("a"));
-    NAR_Cycles(1);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^op"), NAR_Procedure_Test_Op); 
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("a"));
+    NAR_Cycles(nar, 1);
     puts("---------------");
-    NAR_AddInputBelief(Narsese_AtomicTerm("^op"));
-    NAR_Cycles(1);
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("^op"));
+    NAR_Cycles(nar, 1);
     puts("---------------");
-    NAR_AddInputBelief(Narsese_AtomicTerm("result"));
-    NAR_Cycles(1);
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("result"));
+    NAR_Cycles(nar, 1);
     puts("---------------");
-    NAR_AddInputBelief(Narsese_AtomicTerm("a"));
-    NAR_Cycles(1);
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("a"));
+    NAR_Cycles(nar, 1);
     puts("---------------");
-    NAR_AddInputGoal(Narsese_AtomicTerm("result"));
-    NAR_Cycles(1);
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("result"));
+    NAR_Cycles(nar, 1);
     puts("---------------");
     assert(NAR_Procedure_Test_Op_executed, "NAR should have executed op!");
     puts("<<NAR Procedure test successful");
+    NAR_Free(nar);
 }
@@ -0,0 +1,53 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+void BinaryInput_Test()
+{
+    puts(">>BinaryInput test start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    BinaryInput_INIT();
+    FILE *stream = tmpfile();
+    //register with client IDs that differ from the atom indices:
+    BinaryInput_WriteRegistration(stream, 1, "-->");
+    BinaryInput_WriteRegistration(stream, 2, "bird");
+    BinaryInput_WriteRegistration(stream, 3, "animal");
+    Term term = {0};
+    term.atoms[0] = 1; term.atoms[1] = 2; term.atoms[2] = 3;
+    BinaryInput_WriteEvent(stream, &term, '.', true, Truth_New(1.0, 0.5));
+    BinaryInput_WriteCycles(stream, 3);
+    term.atoms[2] = 4; //unregistered
+    BinaryInput_WriteEvent(stream, &term, '.', true, NAR_DEFAULT_TRUTH);
+    rewind(stream);
+    BinaryInput_Frame frame;
+    assert(BinaryInput_ReadFrame(stream, &frame) && frame.type == 'E', "Event frame expected");
+    Term expected = Narsese_Term("<bird --> animal>");
+    assert(Term_Equal(&frame.term, &expected), "Binary event term should match the Narsese one");
+    assert(frame.punctuation == '.' && frame.isEvent && frame.truth.confidence == Numeric_FromReal(0.5), "Event frame content mismatch");
+    assert(BinaryInput_ReadFrame(stream, &frame) && frame.type == 'C' && frame.cycles == 3, "Cycles frame expected");
+    assert(!BinaryInput_ReadFrame(stream, &frame), "Unregistered client ID should be rejected");
+    fclose(stream);
+    puts(">>BinaryInput test successful");
+    NAR_Free(nar);
+}
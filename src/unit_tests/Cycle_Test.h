@@ -0,0 +1,121 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+void Cycle_Test()
+{
+    puts(">>Cycle test start");
+    NAR *nar = NAR_New();
+    bool printInput = PRINT_INPUT, printDerivations = PRINT_DERIVATIONS;
+    PRINT_INPUT = PRINT_DERIVATIONS = false;
+    //without budget the cycles are unbounded
+    NAR_AddInputBelief(nar, Narsese_Term("<a --> b>"));
+    NAR_Cycles(nar, 5);
+    assert(nar->countRealtimeCycles == 0 && nar->countCyclesTruncated == 0, "Cycles without budget shouldn't be truncated");
+    //a budget which can't be met truncates each cycle
+    double budget = CYCLE_BUDGET_MS;
+    CYCLE_BUDGET_MS = 0.000001;
+    for(int i=0; i<10; i++)
+    {
+        NAR_AddInputBelief(nar, Narsese_Term("<b --> c>"));
+        NAR_AddInputBelief(nar, Narsese_Term("<c --> d>"));
+        NAR_Cycles(nar, 1);
+    }
+    assert(nar->countRealtimeCycles == 30 && nar->countCyclesTruncated >= 10, "Cycles with events to process should have been truncated");
+    assert(nar->countConceptInferencesSkipped > 0, "Inference should have been skipped");
+    assert(nar->maxDeadlineOverrunMs >= 0, "Truncated cycles end after their deadline");
+    CYCLE_BUDGET_MS = budget;
+    //idle cycles skipped at once forget as much as the ones performed one by one
+    NAR *skipping = NAR_New(), *stepped = NAR_New();
+    bool fastForward = CYCLE_FAST_FORWARD;
+    for(int k=0; k<2; k++)
+    {
+        NAR *n = k == 0 ? skipping : stepped;
+        CYCLE_FAST_FORWARD = k == 0;
+        NAR_AddInputBelief(n, Narsese_Term("<a --> b>"));
+        NAR_AddInputBelief(n, Narsese_Term("<b --> c>"));
+        NAR_Cycles(n, 1000);
+    }
+    CYCLE_FAST_FORWARD = fastForward;
+    assert(skipping->countCyclesSkipped > 0 && stepped->countCyclesSkipped == 0 && skipping->currentTime == stepped->currentTime, "Idle cycles should have been skipped");
+    assert(skipping->concepts.itemsAmount == stepped->concepts.itemsAmount, "Skipping idle cycles shouldn't change the concepts");
+    for(int i=0; i<skipping->concepts.itemsAmount; i++)
+    {
+        //the concepts are compared by term, as the order of equally useful ones isn't fixed
+        Concept *c = skipping->concepts.items[i].address;
+        Concept *c_stepped = Memory_FindConceptByTerm(stepped, Memory_ConceptTerm(skipping, c));
+        assert(c_stepped != NULL, "Skipping idle cycles shouldn't change the concepts");
+        int slot = Memory_ConceptSlot(skipping, c), slot_stepped = Memory_ConceptSlot(stepped, c_stepped);
+        Item *item_stepped = &stepped->concepts.items[PriorityQueue_IndexOf(&stepped->concepts, slot_stepped)];
+        assert(skipping->concepts.items[i].priority == item_stepped->priority, "Concepts should be ordered by the same usefulness");
+        assert(fabs(Numeric_ToReal(skipping->concept_priority[slot]) - Numeric_ToReal(stepped->concept_priority[slot_stepped])) <= 0.000001 + NUMERIC_EPSILON, "The decayed concept priority should match");
+    }
+    NAR_Free(skipping);
+    NAR_Free(stepped);
+    PRINT_INPUT = printInput; PRINT_DERIVATIONS = printDerivations;
+    NAR_Free(nar);
+    puts("<<Cycle test successful");
+}
+
+static int Cycle_Goals_Test_executed = 0;
+static void Cycle_Goals_Test_Op1(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+    Cycle_Goals_Test_executed = 1;
+}
+static void Cycle_Goals_Test_Op2(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+    Cycle_Goals_Test_executed = 2;
+}
+
+void Cycle_Goals_Test()
+{
+    puts(">>Cycle goals test start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    double motorBabbling = MOTOR_BABBLING_CHANCE;
+    MOTOR_BABBLING_CHANCE = 0;
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^op1"), Cycle_Goals_Test_Op1);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^op2"), Cycle_Goals_Test_Op2);
+    Truth truth = Truth_New(1.0, 0.9);
+    NAR_AddInput(nar, Narsese_Term("<(a &/ ^op1) =/> g1>"), EVENT_TYPE_BELIEF, truth, true);
+    NAR_AddInput(nar, Narsese_Term("<(b &/ ^op2) =/> g2>"), EVENT_TYPE_BELIEF, truth, true);
+    //neither goal can be realized yet, both stay active
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("g1"));
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("g2"));
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("g2"));
+    assert(Cycle_Goals_Test_executed == 0 && nar->goals.itemsAmount == 2, "Both goals should be active, once");
+    //the older goal is realized once its precondition is observed, the other one stays active
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("a"));
+    assert(Cycle_Goals_Test_executed == 1 && nar->goals.itemsAmount == 1, "The first goal should have been realized");
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("b"));
+    assert(Cycle_Goals_Test_executed == 2 && nar->goals.itemsAmount == 0, "The second goal should have been realized");
+    //active goals lose priority till they are dropped
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("g1"));
+    NAR_Cycles(nar, 100);
+    assert(nar->goals.itemsAmount == 0, "The unrealized goal should have been dropped");
+    MOTOR_BABBLING_CHANCE = motorBabbling;
+    NAR_Free(nar);
+    puts("<<Cycle goals test successful");
+}
@@ -0,0 +1,67 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define EVENT_BAG_TEST_SIZE 100
+
+void EventBag_Test()
+{
+    puts(">>EventBag test start");
+    static EventBag_Item items[EVENT_BAG_TEST_SIZE];
+    static int buckets[2*EVENT_BAG_TEST_SIZE];
+    EventBag bag;
+    EventBag_RESET(&bag, items, EVENT_BAG_TEST_SIZE, buckets, 2*EVENT_BAG_TEST_SIZE);
+    Event e = {0};
+    double priority;
+    assert(!EventBag_PopMax(&bag, &e, &priority), "A new bag should be empty");
+    for(int i=0; i<EVENT_BAG_TEST_SIZE; i++)
+    {
+        Event added = { .term = Narsese_AtomicTerm("a"), .truth = Truth_New(1.0, (i+1) / (double) (EVENT_BAG_TEST_SIZE+1)) };
+        assert(EventBag_Add(&bag, &added, (i+1) / (double) EVENT_BAG_TEST_SIZE), "Bag shouldn't be full yet");
+        assert(EventBag_Contains(&bag, &added), "Added event should be contained");
+    }
+    Event lowest = { .term = Narsese_AtomicTerm("a"), .truth = Truth_New(1.0, 1 / (double) (EVENT_BAG_TEST_SIZE+1)) };
+    Event rejected = { .term = Narsese_AtomicTerm("b") };
+    assert(!EventBag_Add(&bag, &rejected, 0.0) && !EventBag_Contains(&bag, &rejected), "Full bag shouldn't take an event of lower priority");
+    Event evicting = { .term = Narsese_AtomicTerm("c") };
+    assert(EventBag_Add(&bag, &evicting, 0.5), "Event of higher priority should evict");
+    assert(!EventBag_Contains(&bag, &lowest) && EventBag_Contains(&bag, &evicting) && bag.itemsAmount == EVENT_BAG_TEST_SIZE, "The lowest priority event should have been evicted");
+    //the levels are taken from the highest
+    double lastPriority = 1.0;
+    for(int i=0; i<EVENT_BAG_TEST_SIZE; i++)
+    {
+        assert(EventBag_PopMax(&bag, &e, &priority), "Bag shouldn't be empty yet");
+        assert(priority <= lastPriority + 1.0 / (EVENT_BAG_LEVELS-1), "Events should be taken by priority level");
+        assert(!EventBag_Contains(&bag, &e), "Taken event shouldn't be contained anymore");
+        lastPriority = priority;
+    }
+    assert(!EventBag_PopMax(&bag, &e, &priority) && bag.itemsAmount == 0, "Bag should be empty again");
+    //decay moves events to lower levels, keeping their order
+    Event older = { .term = Narsese_AtomicTerm("a") }, newer = { .term = Narsese_AtomicTerm("b") };
+    EventBag_Add(&bag, &older, 0.8);
+    EventBag_Add(&bag, &newer, 0.4);
+    EventBag_Decay(&bag, 0.5);
+    assert(EventBag_PopMax(&bag, &e, &priority) && Term_Equal(&e.term, &older.term) && fabs(priority - 0.4) <= NUMERIC_EPSILON, "Decayed event should keep its rank");
+    assert(EventBag_PopMax(&bag, &e, &priority) && Term_Equal(&e.term, &newer.term) && fabs(priority - 0.2) <= NUMERIC_EPSILON, "Decayed event should keep its rank");
+    puts("<<EventBag test successful");
+}
@@ -0,0 +1,78 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define EVENT_QUEUE_TEST_PRODUCERS 4
+#define EVENT_QUEUE_TEST_EVENTS 20000
+
+static EventQueue EventQueue_Test_queue;
+static void *EventQueue_Test_Produce(void *producer)
+{
+    for(long i=0; i<EVENT_QUEUE_TEST_EVENTS; i++)
+    {
+        Event e = { .occurrenceTime = i, .creationTime = (long) producer };
+        while(!EventQueue_Push(&EventQueue_Test_queue, &e)); //retry while full
+    }
+    return NULL;
+}
+
+void EventQueue_Test()
+{
+    puts(">>EventQueue test start");
+    EventQueue *queue = &EventQueue_Test_queue;
+    Event e = {0};
+    assert(!EventQueue_Pop(queue, &e), "A new queue should be empty");
+    for(int i=0; i<EVENT_QUEUE_SIZE; i++)
+    {
+        e.occurrenceTime = i;
+        assert(EventQueue_Push(queue, &e), "Queue shouldn't be full yet");
+    }
+    assert(!EventQueue_Push(queue, &e), "Queue should be full");
+    for(int i=0; i<EVENT_QUEUE_SIZE; i++)
+    {
+        assert(EventQueue_Pop(queue, &e) && e.occurrenceTime == i, "Events should be taken in the order they were added");
+    }
+    assert(!EventQueue_Pop(queue, &e), "Queue should be empty again");
+    //concurrent producers, each one's events have to arrive complete and in order
+    pthread_t producers[EVENT_QUEUE_TEST_PRODUCERS];
+    for(long i=0; i<EVENT_QUEUE_TEST_PRODUCERS; i++)
+    {
+        assert(pthread_create(&producers[i], NULL, EventQueue_Test_Produce, (void*) i) == 0, "Producer thread could not be started");
+    }
+    long expected[EVENT_QUEUE_TEST_PRODUCERS] = {0};
+    for(long received = 0; received < EVENT_QUEUE_TEST_PRODUCERS*EVENT_QUEUE_TEST_EVENTS;)
+    {
+        if(EventQueue_Pop(queue, &e))
+        {
+            assert(e.creationTime >= 0 && e.creationTime < EVENT_QUEUE_TEST_PRODUCERS, "Event of unknown producer");
+            assert(e.occurrenceTime == expected[e.creationTime]++, "Events of a producer should arrive in order");
+            received++;
+        }
+    }
+    for(int i=0; i<EVENT_QUEUE_TEST_PRODUCERS; i++)
+    {
+        pthread_join(producers[i], NULL);
+    }
+    assert(!EventQueue_Pop(queue, &e), "All events should have been taken");
+    puts("<<EventQueue test successful");
+}
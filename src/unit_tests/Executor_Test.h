@@ -0,0 +1,63 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+static bool Executor_Test_executed = false;
+static void Executor_Test_Slow(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+    struct timespec ms20 = { .tv_sec = 0, .tv_nsec = 20000000L };
+    nanosleep(&ms20, NULL);
+    __atomic_store_n(&Executor_Test_executed, true, __ATOMIC_RELEASE);
+}
+
+void Executor_Test()
+{
+    puts(">>Executor test start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    bool printInput = PRINT_INPUT;
+    PRINT_INPUT = false;
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^slow"), Executor_Test_Slow);
+    Executor_Start(nar);
+    Decision decision = { .operationID = Narsese_OperatorIndex("^slow"), .execute = true };
+    Decision_Execute(nar, &decision);
+    assert(!__atomic_load_n(&Executor_Test_executed, __ATOMIC_ACQUIRE) && nar->operationsDispatched == 1, "The action shouldn't have been invoked by the reasoner");
+    //reasoning continues while the action runs
+    long cyclesWhileExecuting = 0;
+    while(!__atomic_load_n(&Executor_Test_executed, __ATOMIC_ACQUIRE))
+    {
+        NAR_Cycles(nar, 1);
+        cyclesWhileExecuting++;
+    }
+    assert(cyclesWhileExecuting > 0, "Cycles should have run while the action was executing");
+    while(__atomic_load_n(&nar->operationsCompleted, __ATOMIC_ACQUIRE) == 0);
+    Term op = Narsese_AtomicTerm("^slow");
+    NAR_Cycles(nar, 1); //the feedback is added in the cycle after the completion
+    Event *feedback = FIFO_GetNewestSequence(&nar->belief_events, 0);
+    assert(feedback != NULL && Term_Equal(&feedback->term, &op), "The feedback should have been added");
+    Executor_Stop(nar);
+    PRINT_INPUT = printInput;
+    NAR_Free(nar);
+    puts("<<Executor test successful");
+}
@@ -31,8 +31,8 @@ void FIFO_Test()
     {
         Event event1 = { .term = Narsese_AtomicTerm("test"), 
                          .type = EVENT_TYPE_BELIEF, 
-                         .truth = { .frequency = 1.0, .confidence = 0.9 },
-                         .stamp = { .evidentalBase = { i } }, 
+                         .truth = Truth_New(1.0, 0.9),
+                         .stamp = Stamp_new(i), 
                          .occurrenceTime = FIFO_SIZE*2 - i*10 };
         FIFO_Add(&event1, &fifo);
     }
@@ -45,8 +45,8 @@ void FIFO_Test()
     int newbase = FIFO_SIZE*2+1;
     Event event2 = { .term = Narsese_AtomicTerm("test"), 
                      .type = EVENT_TYPE_BELIEF, 
-                     .truth = { .frequency = 1.0, .confidence = 0.9 },
-                     .stamp = { .evidentalBase = { newbase } }, 
+                     .truth = Truth_New(1.0, 0.9),
+                     .stamp = Stamp_new(newbase), 
                      .occurrenceTime = i*10+3 };
     FIFO fifo2 = {0};
     for(int i=0; i<FIFO_SIZE*2; i++)
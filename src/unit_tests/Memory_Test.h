@@ -22,27 +22,100 @@
  * THE SOFTWARE.
  */
 
+static void Memory_Test_Op(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+}
+
 void Memory_Test()
 {
-    NAR_INIT();
+    Narsese_INIT();
+    NAR *nar = NAR_New();
     puts(">>Memory test start");
     Event e = Event_InputEvent(Narsese_AtomicTerm("a"), 
                                EVENT_TYPE_BELIEF, 
-                               (Truth) { .frequency = 1, .confidence = 0.9 }, 
-                               1337);
-    Memory_addInputEvent(&e, 0);
-    assert(belief_events.array[0][0].truth.confidence == (double) 0.9, "event has to be there"); //identify
-    Memory_Conceptualize(&e.term, 1);
-    Concept *c1 = Memory_FindConceptByTerm(&e.term);
+                               Truth_New(1, 0.9), 
+                               1337, 1);
+    Memory_addInputEvent(nar, &e, 0);
+    assert(nar->belief_events.array[0][0].truth.confidence == Numeric_FromReal((double) 0.9), "event has to be there"); //identify
+    Memory_Conceptualize(nar, &e.term, 1);
+    Concept *c1 = Memory_FindConceptByTerm(nar, &e.term);
     assert(c1 != NULL, "Concept should have been created!");
     Event e2 = Event_InputEvent(Narsese_AtomicTerm("b"), 
                                EVENT_TYPE_BELIEF, 
-                               (Truth) { .frequency = 1, .confidence = 0.9 }, 
-                               1337);
-    Memory_addInputEvent(&e2, 0);
-    Memory_Conceptualize(&e2.term, 1);
-    Concept *c2 = Memory_FindConceptByTerm(&e2.term);
+                               Truth_New(1, 0.9), 
+                               1337, 2);
+    Memory_addInputEvent(nar, &e2, 0);
+    Memory_Conceptualize(nar, &e2.term, 1);
+    Concept *c2 = Memory_FindConceptByTerm(nar, &e2.term);
     assert(c2 != NULL, "Concept should have been created!");
-    Concept_Print(c2);
+    Concept_Print(&nar->terms, c2);
+    //operations beyond the former limit of 10, only the used ones get implication tables
+    for(int i=0; i<64; i++)
+    {
+        char name[ATOMIC_TERM_LEN_MAX];
+        sprintf(name, "^op%d", i);
+        NAR_AddOperation(nar, Narsese_AtomicTerm(name), Memory_Test_Op);
+    }
+    int op7 = Narsese_OperatorIndex("^op7"), op63 = Narsese_OperatorIndex("^op63");
+    assert(Memory_GetOperation(nar, op63) != NULL && Memory_GetOperation(nar, op63+1) == NULL, "The operations should be registered");
+    assert(Memory_PreconditionBeliefs(nar, c1, op63, false) == NULL && nar->operationTablesUsed == 0, "No tables before they are used");
+    Table *table63 = Memory_PreconditionBeliefs(nar, c1, op63, true);
+    Table *table7 = Memory_PreconditionBeliefs(nar, c1, op7, true);
+    assert(Memory_PreconditionBeliefs(nar, c1, op63, true) == table63 && nar->operationTablesUsed == 2, "The table of an operation should be reused");
+    int opi, visited = 0, lastOpi = -1;
+    for(Table *table = Memory_NextPreconditionBeliefs(nar, c1, NULL, &opi); table != NULL; table = Memory_NextPreconditionBeliefs(nar, c1, table, &opi))
+    {
+        assert(opi > lastOpi && (opi != 0 || table == &c1->precondition_beliefs) && (opi != op7 || table == table7), "The tables should be iterated in order of the operations");
+        lastOpi = opi;
+        visited++;
+    }
+    assert(visited == 3, "The table without operation and the two used ones should have been iterated");
+    //recycling a concept removes the implications with it as source from the tables
+    Implication imp = { .term = Narsese_Term("<b =/> a>"), .truth = Truth_New(1.0, 0.9), .stamp = Stamp_new(3), .sourceConcept = c2, .sourceConceptId = c2->id };
+    Table_AddAndRevise(nar, Memory_PreconditionBeliefs(nar, c1, 0, true), &imp);
+    assert(c2->sourcedImplications == 1 && c1->precondition_beliefs.itemsAmount == 1, "The implication should be counted for its source");
+    PriorityQueue_Update(&nar->concepts, PriorityQueue_IndexOf(&nar->concepts, Memory_ConceptSlot(nar, c2)), 0.0); //evicted first
+    for(int i=0; Memory_FindConceptByTerm(nar, &e2.term) != NULL; i++)
+    {
+        char narsese[NARSESE_LEN_MAX];
+        sprintf(narsese, "<(%c * %c) --> %c>", 'a' + i % 26, 'a' + (i / 26) % 26, 'a' + i / (26*26));
+        Term term = Narsese_Term(narsese);
+        Memory_Conceptualize(nar, &term, 2);
+    }
+    assert(Memory_FindConceptByTerm(nar, &e.term) == c1 && c1->precondition_beliefs.itemsAmount == 0, "The implication of the recycled concept should have been removed");
+    for(int i=0; i<nar->concepts.itemsAmount; i++)
+    {
+        Concept *c = nar->concepts.items[i].address;
+        for(Table *table = Memory_NextPreconditionBeliefs(nar, c, NULL, &opi); table != NULL; table = Memory_NextPreconditionBeliefs(nar, c, table, &opi))
+        {
+            for(int j=0; j<table->itemsAmount; j++)
+            {
+                assert(Memory_ImplicationValid(Table_At(table, j)), "No table should refer to a recycled concept");
+            }
+        }
+    }
+    //also after a goal was processed, whose spikes are cleared from the flags of the concepts
+    NAR *goalNar = NAR_New();
+    bool printInput = PRINT_INPUT;
+    PRINT_INPUT = false;
+    Term g = Narsese_AtomicTerm("g");
+    NAR_AddInput(goalNar, Narsese_Term("<a =/> g>"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, true);
+    NAR_AddInputGoal(goalNar, g);
+    PRINT_INPUT = printInput;
+    Concept *source = Memory_FindConceptByTerm(goalNar, &e.term), *target = Memory_FindConceptByTerm(goalNar, &g);
+    assert(source != NULL && target != NULL && target->precondition_beliefs.itemsAmount == 1 && source->sourcedImplications == 1, "The implication should be in the table of its postcondition");
+    assert(goalNar->concept_flags[Memory_ConceptSlot(goalNar, target)] & CONCEPT_FLAG_IMPLICATIONS, "Clearing the goal spikes shouldn't clear the other flags");
+    PriorityQueue_Update(&goalNar->concepts, PriorityQueue_IndexOf(&goalNar->concepts, Memory_ConceptSlot(goalNar, source)), 0.0); //evicted first
+    for(int i=0; Memory_FindConceptByTerm(goalNar, &e.term) != NULL; i++)
+    {
+        char narsese[NARSESE_LEN_MAX];
+        sprintf(narsese, "<(%c * %c) --> %c>", 'a' + i % 26, 'a' + (i / 26) % 26, 'a' + i / (26*26));
+        Term term = Narsese_Term(narsese);
+        Memory_Conceptualize(goalNar, &term, goalNar->currentTime);
+    }
+    assert(Memory_FindConceptByTerm(goalNar, &g) == target && target->precondition_beliefs.itemsAmount == 0, "The implication of the recycled concept should have been removed after the goal cycle");
+    NAR_Free(goalNar);
     puts("<<Memory test successful");
+    NAR_Free(nar);
 }
@@ -0,0 +1,94 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#define NAR_TEST_INSTANCES 8
+
+static NAR *NAR_Test_instances[NAR_TEST_INSTANCES+1];
+static int NAR_Test_executions[NAR_TEST_INSTANCES+1];
+static void NAR_Test_Op(NAR *nar, Term args)
+{
+    (void) args;
+    int i = 0;
+    for(; i<=NAR_TEST_INSTANCES && NAR_Test_instances[i] != nar; i++);
+    assert(i <= NAR_TEST_INSTANCES, "Operation executed by an unknown instance");
+    __atomic_add_fetch(&NAR_Test_executions[i], 1, __ATOMIC_RELAXED);
+}
+
+//Drives an instance with atomic events only, so that its behaviour doesn't depend on the order of parallel derivations
+static void *NAR_Test_Run(void *instance)
+{
+    NAR *nar = instance;
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^left"), NAR_Test_Op);
+    for(int i=0; i<40; i++)
+    {
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm(i % 2 ? "a" : "b"));
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm("^left"));
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm("c"));
+        NAR_AddInputGoal(nar, Narsese_AtomicTerm("c"));
+        NAR_Cycles(nar, i % 3);
+    }
+    return NULL;
+}
+
+void NAR_Test()
+{
+    puts(">>NAR test start");
+    Narsese_INIT();
+    bool printInput = PRINT_INPUT;
+    PRINT_INPUT = false;
+    Term question = Narsese_Term("<(a &/ ^left) =/> c>");
+    //the reference instance runs alone, the others concurrently
+    for(int i=0; i<=NAR_TEST_INSTANCES; i++)
+    {
+        NAR_Test_instances[i] = NAR_New();
+        NAR_Test_executions[i] = 0;
+    }
+    NAR_Test_Run(NAR_Test_instances[0]);
+    pthread_t threads[NAR_TEST_INSTANCES];
+    for(int i=1; i<=NAR_TEST_INSTANCES; i++)
+    {
+        assert(pthread_create(&threads[i-1], NULL, NAR_Test_Run, NAR_Test_instances[i]) == 0, "NAR test thread could not be started");
+    }
+    for(int i=1; i<=NAR_TEST_INSTANCES; i++)
+    {
+        pthread_join(threads[i-1], NULL);
+    }
+    NAR *reference = NAR_Test_instances[0];
+    Answer referenceAnswer = Query_Ask(reference, &question, false, reference->currentTime);
+    assert(referenceAnswer.truth.confidence > 0 && NAR_Test_executions[0] > 0, "The reference instance should have learned and executed");
+    for(int i=1; i<=NAR_TEST_INSTANCES; i++)
+    {
+        NAR *nar = NAR_Test_instances[i];
+        Answer answer = Query_Ask(nar, &question, false, nar->currentTime);
+        assert(nar->currentTime == reference->currentTime && nar->concepts.itemsAmount == reference->concepts.itemsAmount, "Instances should be independent");
+        assert(Truth_Equal(&answer.truth, &referenceAnswer.truth), "Instances should have learned the same");
+        assert(NAR_Test_executions[i] == NAR_Test_executions[0], "Instances should have executed the same");
+    }
+    for(int i=0; i<=NAR_TEST_INSTANCES; i++)
+    {
+        NAR_Free(NAR_Test_instances[i]);
+    }
+    PRINT_INPUT = printInput;
+    puts(">>NAR test successful");
+}
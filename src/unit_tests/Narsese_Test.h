@@ -27,14 +27,6 @@ void Narsese_Test()
     puts(">>Narsese test start");
     char* narsese = "<<$sth --> (&,[furry,meowing],animal)> =/> <$sth --> [good]>>";
     printf("Narsese: %s\n", narsese);
-    char* preprocessed = Narsese_Expand(narsese);
-    printf("Preprocessed: %s\n", preprocessed);
-    char **tokens = Narsese_PrefixTransform(preprocessed);
-    int k = 0;
-    for(;tokens[k] != NULL;k++)
-    {
-        printf("token: %s\n", tokens[k]);
-    }
     Term ret = Narsese_Term(narsese);
     for(int i=0; i<COMPOUND_TERM_SIZE_MAX; i++)
     {
@@ -46,7 +38,39 @@ void Narsese_Test()
     puts("Result:");
     Narsese_PrintTerm(&ret);
     puts("");
+    //structure check of the binary tree encoding:
+    assert(Narsese_copulaEquals(ret.atoms[0], '$'), "Root should be an implication");
+    assert(Narsese_copulaEquals(ret.atoms[1], ':') && Narsese_copulaEquals(ret.atoms[2], ':'), "Both sides should be inheritances");
+    assert(ret.atoms[3] == Narsese_AtomicTermIndex("$sth") && ret.atoms[5] == ret.atoms[3], "Subject should be $sth on both sides");
+    assert(Narsese_copulaEquals(ret.atoms[4], '&'), "Predicate should be an extensional intersection");
+    assert(Narsese_copulaEquals(ret.atoms[9], '\'') && Narsese_copulaEquals(ret.atoms[6], '\''), "Intensional sets expected");
+    assert(ret.atoms[10] == Narsese_AtomicTermIndex("animal"), "animal expected as second intersection element");
+    assert(Narsese_copulaEquals(ret.atoms[14], '@'), "Unary set should be terminated by @");
+    //prefix and infix forms, as well as the multi-char copulas, encode the same term:
+    Term prefix = Narsese_Term("(--> $sth (& (' furry meowing) animal))");
+    Term infix = Narsese_Term("<$sth --> (&,[furry,meowing],animal)>");
+    assert(Term_Equal(&prefix, &infix), "Prefix and infix form should encode the same term");
+    Term seq1 = Narsese_Term("(a &/ b)");
+    Term seq2 = Narsese_Term("(&/,a,b)");
+    assert(Term_Equal(&seq1, &seq2) && Narsese_copulaEquals(seq1.atoms[0], '+'), "Sequence encoding mismatch");
+    //sentence parsing:
+    Term term;
+    char punctuation;
+    bool isEvent;
+    Truth tv;
+    assert(Narsese_Sentence("<a --> b>. :|: {0.3 0.4}", &term, &punctuation, &isEvent, &tv), "Sentence should parse");
+    assert(punctuation == '.' && isEvent && Truth_Equal(&tv, &Truth_New(0.3, 0.4)), "Sentence components mismatch");
+    assert(Narsese_Sentence("(a &/ ^left)!", &term, &punctuation, &isEvent, &tv), "Goal should parse");
+    assert(punctuation == '!' && !isEvent && tv.frequency == Numeric_FromReal(NAR_DEFAULT_FREQUENCY), "Default truth expected");
+    assert(Narsese_isOperator(term.atoms[2]), "^left should be an operator");
+    //malformed input is reported, not asserted:
+    assert(!Narsese_Sentence("<a --> b", &term, &punctuation, &isEvent, &tv), "Missing punctuation should fail");
+    assert(!Narsese_Sentence("<a --> b.", &term, &punctuation, &isEvent, &tv), "Unbalanced brackets should fail");
+    assert(!Narsese_Sentence("<a --> b> c.", &term, &punctuation, &isEvent, &tv), "Trailing tokens should fail");
+    assert(!Narsese_Sentence("<a --> b>.{1.0 0.9}", &term, &punctuation, &isEvent, &tv), "Space before truth value is required");
+    assert(!Narsese_Sentence("<a --> b>. {1.0}", &term, &punctuation, &isEvent, &tv), "Incomplete truth value should fail");
+    assert(!Narsese_ParseTerm("<a b>", &term), "Missing copula should fail");
+    assert(!Narsese_ParseTerm("<(a * (b * (c * (d * (e * f))))) --> g>", &term), "Too deep term should fail");
+    assert(!Narsese_ParseTerm("averyveryveryveryveryverylongatomname", &term), "Too long atom name should fail");
     puts(">>Narsese Test successul");
-    Narsese_PrintTerm(&ret);
-    puts("");
 }
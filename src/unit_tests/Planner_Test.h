@@ -0,0 +1,73 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+static int Planner_Test_executed = 0;
+static void Planner_Test_Op1(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+    Planner_Test_executed = 1;
+}
+static void Planner_Test_Op2(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+    Planner_Test_executed = 2;
+}
+static void Planner_Test_Op3(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+    Planner_Test_executed = 3;
+}
+
+void Planner_Test()
+{
+    puts(">>Planner test start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    bool bestFirst = BEST_FIRST_PLANNING;
+    double motorBabbling = MOTOR_BABBLING_CHANCE;
+    BEST_FIRST_PLANNING = true;
+    MOTOR_BABBLING_CHANCE = 0;
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^op1"), Planner_Test_Op1);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^op2"), Planner_Test_Op2);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^op3"), Planner_Test_Op3);
+    Truth truth = Truth_New(1.0, 0.9);
+    NAR_AddInput(nar, Narsese_Term("<(a &/ ^op1) =/> b>"), EVENT_TYPE_BELIEF, truth, true);
+    NAR_AddInput(nar, Narsese_Term("<(b &/ ^op2) =/> c>"), EVENT_TYPE_BELIEF, truth, true);
+    NAR_AddInput(nar, Narsese_Term("<(c &/ ^op3) =/> g>"), EVENT_TYPE_BELIEF, truth, true);
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("a"));
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("g"));
+    //g to c to b, where ^op1 applies
+    assert(Planner_Test_executed == 1, "The planner should have found the first step");
+    assert(nar->planningExpansions > 0 && nar->planningExpansions <= PLANNING_EXPANSION_BUDGET, "Expansions should stay within the budget");
+    //the same goal again re-derives the subgoals from the memoised plan
+    long expansions = nar->planningExpansions;
+    Planner_Test_executed = 0;
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("a"));
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("g"));
+    assert(Planner_Test_executed == 1 && nar->plansReused > 0 && nar->planningExpansions == expansions, "The plan should have been reused");
+    BEST_FIRST_PLANNING = bestFirst;
+    MOTOR_BABBLING_CHANCE = motorBabbling;
+    NAR_Free(nar);
+    puts("<<Planner test successful");
+}
@@ -22,6 +22,35 @@
  * THE SOFTWARE.
  */
 
+//Whether the min-max heap property holds and the slots point to the items
+static bool PriorityQueue_Test_Valid(PriorityQueue *queue)
+{
+    for(int i=0; i<queue->itemsAmount; i++)
+    {
+        if(queue->slots[queue->items[i].handle] != i)
+        {
+            return false;
+        }
+        int level = 0;
+        for(int n=i+1; n>1; n >>= 1)
+        {
+            level++;
+        }
+        bool maxLevel = level & 1;
+        //compare with the children and grandchildren, the rest follows transitively
+        int descendants[6] = { 2*i+1, 2*i+2, 4*i+3, 4*i+4, 4*i+5, 4*i+6 };
+        for(int k=0; k<6; k++)
+        {
+            int d = descendants[k];
+            if(d < queue->itemsAmount && (maxLevel ? queue->items[d].priority > queue->items[i].priority : queue->items[d].priority < queue->items[i].priority))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 void PriorityQueue_Test()
 {
     puts(">>PriorityQueue test start");
@@ -33,21 +62,78 @@ void PriorityQueue_Test()
         items[i].address = (void*) ((long) i+1);
         items[i].priority = 0;
     }
-    PriorityQueue_RESET(&queue, items, n_items);
+    int slots[n_items];
+    PriorityQueue_RESET(&queue, items, slots, n_items);
     for(int i=0, evictions=0; i<n_items*2; i++)
     {
         PriorityQueue_Push_Feedback feedback = PriorityQueue_Push(&queue, 1.0/((double) (n_items*2-i)));
         if(feedback.added)
         {
-            printf("item was added %f %ld\n", feedback.addedItem.priority, (long)feedback.addedItem.address);
+            printf("item was added %f %ld\n", Numeric_ToReal(feedback.addedItem.priority), (long)feedback.addedItem.address);
         }
         if(feedback.evicted)
         {
-            printf("evicted item %f %ld\n", feedback.evictedItem.priority, (long)feedback.evictedItem.address);
-            assert(evictions>0 || feedback.evictedItem.priority == ((double)(1.0/((double) (n_items*2)))), "the evicted item has to be the lowest priority one");
+            printf("evicted item %f %ld\n", Numeric_ToReal(feedback.evictedItem.priority), (long)feedback.evictedItem.address);
+            assert(evictions>0 || feedback.evictedItem.priority == Numeric_FromReal((double)(1.0/((double) (n_items*2)))), "the evicted item has to be the lowest priority one");
             assert(queue.itemsAmount < n_items+1, "eviction should only happen when full!");
             evictions++;
         }
     }
+    assert(PriorityQueue_Test_Valid(&queue), "Pushing should keep the heap valid");
+    //the handles find the items wherever they moved
+    for(int i=0; i<queue.itemsAmount; i++)
+    {
+        int handle = queue.items[i].handle;
+        PriorityQueue_Update(&queue, i, 0.5 + (i % 3) * 0.2);
+        int j = PriorityQueue_IndexOf(&queue, handle);
+        assert(j >= 0 && queue.items[j].handle == handle, "The handle should lead to the updated item");
+        assert(PriorityQueue_Test_Valid(&queue), "Updating should keep the heap valid");
+    }
+    void *address;
+    double priority;
+    int removedHandle = queue.items[3].handle;
+    PriorityQueue_PopAt(&queue, 3, &address);
+    assert(PriorityQueue_IndexOf(&queue, removedHandle) == -1 && PriorityQueue_Test_Valid(&queue), "Removed item shouldn't be in the queue anymore");
+    //bulk changes followed by a rebuild
+    srand(1337);
+    for(int i=0; i<queue.itemsAmount; i++)
+    {
+        queue.items[i].priority = Numeric_FromReal(rand() / (double) RAND_MAX);
+    }
+    PriorityQueue_Rebuild(&queue);
+    assert(PriorityQueue_Test_Valid(&queue), "Rebuilding should restore the heap");
+    //batched pops come in descending order, a batched push into a large enough queue rebuilds once
+    void *addresses[n_items];
+    double priorities[n_items];
+    int popped = PriorityQueue_PopMaxBatch(&queue, n_items, addresses, priorities);
+    assert(popped == n_items-1 && queue.itemsAmount == 0, "All items should have been popped");
+    for(int i=1; i<popped; i++)
+    {
+        assert(priorities[i] <= priorities[i-1], "Batched pops should be in descending order");
+    }
+    PriorityQueue_Push_Feedback feedbacks[n_items];
+    PriorityQueue_PushBatch(&queue, priorities, popped, feedbacks);
+    assert(queue.itemsAmount == popped && PriorityQueue_Test_Valid(&queue), "Batched push should give a valid heap");
+    for(int i=0; i<popped; i++)
+    {
+        assert(feedbacks[i].added, "The batched items should have been added");
+    }
+    assert(PriorityQueue_PopMax(&queue, NULL, &priority) && priority == priorities[0], "The maximum should come first");
+    //many items, with random updates
+    int n_many = 1000;
+    Item *many = malloc(n_many * sizeof(Item));
+    int *manySlots = malloc(n_many * sizeof(int));
+    PriorityQueue_RESET(&queue, many, manySlots, n_many);
+    for(int i=0; i<n_many; i++)
+    {
+        PriorityQueue_Push(&queue, rand() / (double) RAND_MAX);
+    }
+    for(int i=0; i<n_many; i++)
+    {
+        PriorityQueue_Update(&queue, PriorityQueue_IndexOf(&queue, rand() % n_many), rand() / (double) RAND_MAX);
+    }
+    assert(PriorityQueue_Test_Valid(&queue), "Random updates should keep the heap valid");
+    free(many);
+    free(manySlots);
     puts("<<PriorityQueue test successful");
 }
@@ -0,0 +1,54 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+void Query_Test()
+{
+    puts(">>Query test start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    bool printInput = PRINT_INPUT;
+    PRINT_INPUT = false;
+    Term questions[3] = { Narsese_Term("<?1 --> b>"), Narsese_Term("<a0 --> b>"), Narsese_Term("<(a1 &/ ^left) =/> b>") };
+    bool isEvent[3] = { true, false, false };
+    for(int i=0; i<60; i++)
+    {
+        char narsese[NARSESE_LEN_MAX];
+        sprintf(narsese, "<a%d --> b>", i % 5);
+        NAR_AddInput(nar, Narsese_Term(narsese), EVENT_TYPE_BELIEF, Truth_New((i % 3) / 2.0, 0.9), i % 2);
+        NAR_AddInput(nar, Narsese_Term("<(a1 &/ ^left) =/> b>"), EVENT_TYPE_BELIEF, Truth_New((i % 4) / 3.0, 0.5), true);
+        for(int j=0; j<3; j++)
+        {
+            //the incrementally maintained answer has to be as good as the one of the full scan
+            Answer standing = Query_Ask(nar, &questions[j], isEvent[j], nar->currentTime);
+            Answer scanned = Query_Scan(nar, &questions[j], isEvent[j], nar->currentTime);
+            //ties can be broken differently, so compare the expectation the answers were chosen by, up to the rounding of the numeric profile
+            double standingExp = Truth_Expectation(Truth_Projection(standing.truth, standing.occurrenceTime, nar->currentTime));
+            double scannedExp = Truth_Expectation(Truth_Projection(scanned.truth, scanned.occurrenceTime, nar->currentTime));
+            assert(fabs(standingExp - scannedExp) < 0.000001 + NUMERIC_EPSILON, "Standing query answer differs from the memory scan");
+        }
+    }
+    PRINT_INPUT = printInput;
+    puts(">>Query test successful");
+    NAR_Free(nar);
+}
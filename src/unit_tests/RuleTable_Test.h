@@ -25,9 +25,11 @@
 void RuleTable_Test()
 {
     puts(">>RuleTable test start");
-    NAR_INIT();
-    NAR_AddInput(Narsese_Term("<cat --> animal>"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, true);
-    NAR_AddInput(Narsese_Term("<animal --> being>"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, true);
-    NAR_Cycles(1);
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    NAR_AddInput(nar, Narsese_Term("<cat --> animal>"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, true);
+    NAR_AddInput(nar, Narsese_Term("<animal --> being>"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, true);
+    NAR_Cycles(nar, 1);
     puts(">>RuleTable test successul");
+    NAR_Free(nar);
 }
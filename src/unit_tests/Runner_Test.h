@@ -0,0 +1,90 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+static void Runner_Test_Op(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+    assert(false, "Actions shouldn't be invoked while the runner is active");
+}
+
+//Waits till the runner performed the cycles
+static void Runner_Test_Wait(NAR *nar, long cycles)
+{
+    long until = __atomic_load_n(&nar->currentTime, __ATOMIC_RELAXED) + cycles;
+    while(__atomic_load_n(&nar->currentTime, __ATOMIC_RELAXED) < until)
+    {
+        sched_yield();
+    }
+}
+
+void Runner_Test()
+{
+    puts(">>Runner test start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    bool printInput = PRINT_INPUT;
+    PRINT_INPUT = false;
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^left"), Runner_Test_Op);
+    Runner_Start(nar, 1000); //paced, so that the waits below see each cycle
+    int queued = 0;
+    for(int i=0; i<10; i++)
+    {
+        char *sequence[3] = { "a", "^left", "c" };
+        for(int k=0; k<3; k++)
+        {
+            queued += NAR_QueueInput(nar, Narsese_AtomicTerm(sequence[k]), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false);
+            Runner_Test_Wait(nar, 2);
+        }
+        Runner_Test_Wait(nar, 10);
+    }
+    queued += NAR_QueueInput(nar, Narsese_AtomicTerm("a"), EVENT_TYPE_BELIEF, NAR_DEFAULT_TRUTH, false);
+    Runner_Test_Wait(nar, 2);
+    queued += NAR_QueueInput(nar, Narsese_AtomicTerm("c"), EVENT_TYPE_GOAL, NAR_DEFAULT_TRUTH, false);
+    Runner_Test_Wait(nar, 2);
+    Runner_Stop(nar);
+    Event execution;
+    assert(queued == 32 && !EventQueue_Pop(&nar->inputs, &execution) && nar->base-1 >= queued, "All queued input should have been added");
+    bool executed = false;
+    while(Runner_NextExecution(nar, &execution))
+    {
+        executed |= Term_Equal(&execution.term, &nar->operations[Narsese_OperatorIndex("^left")-1].term);
+    }
+    assert(executed, "The execution should have been delivered through the queue");
+    //paced runner keeps its rate, unpaced runs as fast as possible
+    struct timespec ms50 = { .tv_sec = 0, .tv_nsec = 50000000L };
+    long start = nar->currentTime;
+    Runner_Start(nar, 1000);
+    nanosleep(&ms50, NULL);
+    Runner_Stop(nar);
+    long paced = nar->currentTime - start;
+    assert(paced > 0 && paced <= 100, "The runner should keep its rate");
+    start = nar->currentTime;
+    Runner_Start(nar, 0);
+    nanosleep(&ms50, NULL);
+    Runner_Stop(nar);
+    assert(nar->currentTime - start > paced, "The unpaced runner should be faster");
+    PRINT_INPUT = printInput;
+    NAR_Free(nar);
+    puts("<<Runner test successful");
+}
@@ -25,13 +25,32 @@
 void Stamp_Test()
 {
     puts(">>Stamp test start");
-    Stamp stamp1 = { .evidentalBase = {1,2} };
+    Stamp base1 = Stamp_new(1), base2 = Stamp_new(2), base3 = Stamp_new(3), base4 = Stamp_new(4);
+    Stamp stamp1 = Stamp_make(&base1, &base2);
     Stamp_print(&stamp1);
-    Stamp stamp2 = { .evidentalBase = {2,3,4} };
+    Stamp stamp23 = Stamp_make(&base2, &base3);
+    Stamp stamp2 = Stamp_make(&stamp23, &base4);
     Stamp_print(&stamp2);
     Stamp stamp3 = Stamp_make(&stamp1, &stamp2);
     fputs("zipped:", stdout);
     Stamp_print(&stamp3);
     assert(Stamp_checkOverlap(&stamp1,&stamp2) == true, "Stamp should overlap");
+    //zipping interleaves the bases
+    assert(stamp3.length == 5 && stamp3.evidentalBase[0] == 1 && stamp3.evidentalBase[1] == 2 && stamp3.evidentalBase[2] == 2 &&
+           stamp3.evidentalBase[3] == 4 && stamp3.evidentalBase[4] == 3, "Zipped stamp should interleave the bases");
+    assert(!Stamp_checkOverlap(&stamp1, &base3) && !Stamp_checkOverlap(&base3, &base4), "Distinct bases shouldn't overlap");
+    //bases sharing their summary bit only overlap if they are equal
+    Stamp base65 = Stamp_new(65), baseNegative = Stamp_new(-63);
+    assert(!Stamp_checkOverlap(&base1, &base65) && !Stamp_checkOverlap(&base1, &baseNegative) && Stamp_checkOverlap(&base65, &base65), "Only equal bases should overlap");
+    //zipping is limited to the stamp size, keeping the bases taken first
+    Stamp full = Stamp_new(100);
+    for(int i=1; i<STAMP_SIZE*2; i++)
+    {
+        Stamp input = Stamp_new(100+i);
+        full = Stamp_make(&input, &full);
+    }
+    assert(full.length == STAMP_SIZE && full.evidentalBase[0] == 100+STAMP_SIZE*2-1, "Stamp should be limited to its size");
+    Stamp last = Stamp_new(100+STAMP_SIZE*2-1), dropped = Stamp_new(100);
+    assert(Stamp_checkOverlap(&full, &last) && !Stamp_checkOverlap(&full, &dropped), "Only the kept bases should overlap");
     puts("<<Stamp test successful");
 }
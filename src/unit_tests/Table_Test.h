@@ -25,28 +25,53 @@
 void Table_Test()
 {
     puts(">>Table test start");
+    NAR *nar = NAR_New();
     Concept sourceConcept = {0};
     Table table = {0};
     for(int i=TABLE_SIZE*2; i>=1; i--)
     {
         Implication imp = { .term = Narsese_AtomicTerm("test"), 
-                            .truth = { .frequency = 1.0, .confidence = 1.0/((double)(i+1)) },
-                            .stamp = { .evidentalBase = { i } },
+                            .truth = Truth_New(1.0, 1.0/((double)(i+1))),
+                            .stamp = Stamp_new(i),
                             .occurrenceTimeOffset = 10,
                             .sourceConcept = &sourceConcept };
-        Table_Add(&table, &imp);
+        Table_Add(nar, &table, &imp);
     }
     for(int i=0; i<TABLE_SIZE; i++)
     {
-        assert(i+1 == table.array[i].stamp.evidentalBase[0], "Item at table position has to be right");
+        assert(i+1 == Table_At(&table, i)->stamp.evidentalBase[0], "Item at table position has to be right");
     }
     Implication imp = { .term = Narsese_AtomicTerm("test"), 
-                        .truth = { .frequency = 1.0, .confidence = 0.9},
-                        .stamp = { .evidentalBase = { TABLE_SIZE*2+1 } },
+                        .truth = Truth_New(1.0, 0.9),
+                        .stamp = Stamp_new(TABLE_SIZE*2+1),
                         .occurrenceTimeOffset = 10,
                         .sourceConcept = &sourceConcept };
-    assert(table.array[0].truth.confidence==0.5, "The highest confidence one should be the first.");
-    Table_AddAndRevise(&table, &imp);
-    assert(table.array[0].truth.confidence>0.5, "The revision result should be more confident than the table element that existed.");
+    assert(Table_At(&table, 0)->truth.confidence==Numeric_FromReal(0.5), "The highest confidence one should be the first.");
+    Table_AddAndRevise(nar, &table, &imp);
+    assert(Truth_Confidence(Table_At(&table, 0)->truth)>0.5, "The revision result should be more confident than the table element that existed.");
+    //implications stay at their address while the ranks change, removed slots are reused
+    Table ranked = {0};
+    Implication *added[TABLE_SIZE];
+    for(int i=0; i<TABLE_SIZE; i++)
+    {
+        char narsese[NARSESE_LEN_MAX];
+        sprintf(narsese, "<a%d =/> b>", i);
+        Implication ranked_imp = { .term = Narsese_Term(narsese), .truth = Truth_New(1.0, 0.1 + i * 0.04), .stamp = Stamp_new(i+1), .sourceConcept = &sourceConcept };
+        added[i] = Table_AddAndRevise(nar, &ranked, &ranked_imp);
+        assert(Table_At(&ranked, 0) == added[i], "The most confident one should be the first");
+    }
+    Implication *first = added[0];
+    Table_Remove(nar, &ranked, TABLE_SIZE/2);
+    assert(ranked.itemsAmount == TABLE_SIZE-1 && Table_At(&ranked, TABLE_SIZE-2) == first, "Removing shouldn't move the other implications");
+    Implication revision = *added[TABLE_SIZE-1];
+    revision.stamp = Stamp_new(TABLE_SIZE+1);
+    Implication *revised = Table_AddAndRevise(nar, &ranked, &revision);
+    assert(ranked.itemsAmount == TABLE_SIZE-1 && Table_At(&ranked, 0) == revised, "Revision should be found by the term");
+    for(int i=1; i<ranked.itemsAmount; i++)
+    {
+        assert(ranked.expectations[i] <= ranked.expectations[i-1] && ranked.expectations[i] == Truth_Expectation(Table_At(&ranked, i)->truth), "Ranks should stay ordered by expectation");
+    }
+    assert(ranked.slotsAmount == TABLE_SIZE, "Freed slots should be reused");
     puts("<<Table test successful");
+    NAR_Free(nar);
 }
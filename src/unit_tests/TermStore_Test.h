@@ -0,0 +1,63 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+void TermStore_Test()
+{
+    puts(">>TermStore test start");
+    static TermStore store;
+    TermStore_INIT(&store);
+    Term a = Narsese_Term("<a --> b>"), a2 = Narsese_Term("<a --> b>"), b = Narsese_Term("<b --> a>");
+    TermHandle ha = TermStore_Intern(&store, &a);
+    assert(ha != 0 && TermStore_Intern(&store, &a2) == ha, "Equal terms should share their handle");
+    TermHandle hb = TermStore_Intern(&store, &b);
+    assert(hb != 0 && hb != ha && store.amount == 2, "Different terms should get different handles");
+    assert(Term_Equal(TermStore_Term(&store, ha), &a) && TermStore_Hash(&store, ha) == Term_Hash(&a), "The handle should give the term and its hash");
+    TermStore_Release(&store, ha);
+    assert(TermStore_Find(&store, &a) == ha, "The term is still referenced once");
+    TermStore_Release(&store, ha);
+    assert(TermStore_Find(&store, &a) == 0 && TermStore_Find(&store, &b) == hb && store.amount == 1, "The term should be reclaimed with its last reference");
+    assert(TermStore_Intern(&store, &a) == ha, "The reclaimed entry should be reused");
+    //equal subterms have equal hashes wherever they are
+    Term c = Narsese_Term("<(a * b) --> b>");
+    TermHashes hc, hb2;
+    Term_SubtermHashes(&c, &hc);
+    Term_SubtermHashes(&b, &hb2);
+    assert(hc.hashes[2] == hc.hashes[4] && Term_SubtermEqual(&c, 2, &c, 4), "Both b should have the same hash");
+    assert(hc.hashes[2] == hb2.hashes[1] && Term_SubtermEqual(&c, 2, &b, 1), "Subterms of different terms should be comparable");
+    assert(hc.hashes[3] != hc.hashes[4] && !Term_SubtermEqual(&c, 3, &c, 4), "a and b should differ");
+    assert(hc.hashes[5] == 0 && TermStore_SubtermHashes(&store, hb)->hashes[0] == hb2.hashes[0], "The store should keep the hashes of its terms");
+    //the concepts hold the references, an evicted concept releases its term
+    NAR *nar = NAR_New();
+    for(int i=0; i<CONCEPTS_MAX+1; i++)
+    {
+        char narsese[NARSESE_LEN_MAX];
+        sprintf(narsese, "<(%c * %c) --> %c>", 'a' + i % 26, 'a' + (i / 26) % 26, 'a' + i / (26*26));
+        Term term = Narsese_Term(narsese);
+        Concept *c = Memory_Conceptualize(nar, &term, i);
+        assert(c != NULL && Memory_FindConceptByTerm(nar, &term) == c && Term_Equal(Memory_ConceptTerm(nar, c), &term), "The concept should be found via its term");
+    }
+    assert(nar->terms.amount == CONCEPTS_MAX, "Each concept should hold the handle of its term");
+    NAR_Free(nar);
+    puts("<<TermStore test successful");
+}
@@ -0,0 +1,137 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//Skips the records up to the next decision record and reads its operation and implication term
+static bool Trace_Test_NextDecision(FILE *trace, int *operationID, Term *term)
+{
+    int c;
+    while((c = fgetc(trace)) != EOF)
+    {
+        uint8_t u8, n;
+        uint16_t u16;
+        char skip[256];
+        switch(c)
+        {
+            case 'A': //atom, length, name
+                assert(fread(&u8, 1, 1, trace) == 1 && fread(&n, 1, 1, trace) == 1 && fread(skip, 1, n, trace) == n, "Truncated atom record");
+                break;
+            case 'R': //rule, length, name
+                assert(fread(&u16, 2, 1, trace) == 1 && fread(&u16, 2, 1, trace) == 1 && fread(skip, 1, u16, trace) == u16, "Truncated rule record");
+                break;
+            case 'K': //flags, type, rule, f, c, priority, occurrence time, creation time, stamp, term
+                assert(fread(skip, 1, 4+5*8, trace) == 4+5*8 && fread(&n, 1, 1, trace) == 1 && fread(skip, 8, n, trace) == n, "Truncated knowledge record");
+                assert(fread(&n, 1, 1, trace) == 1 && fread(skip, 1, n, trace) == n, "Truncated knowledge record");
+                break;
+            case 'X': //operation, desire, f, c, offset, time, term
+                assert(fread(&u16, 2, 1, trace) == 1 && fread(skip, 1, 5*8, trace) == 5*8, "Truncated decision record");
+                *operationID = u16;
+                *term = (Term) {0};
+                assert(fread(&n, 1, 1, trace) == 1 && n <= COMPOUND_TERM_SIZE_MAX && fread(term->atoms, 1, n, trace) == n, "Truncated decision record");
+                return true;
+            default:
+                assert(false, "Unknown trace record");
+        }
+    }
+    return false;
+}
+
+static void Trace_Test_Op(NAR *nar, Term args)
+{
+    (void) nar; (void) args;
+}
+
+//All candidate implications apply, the traced decision needs to come from the most confident one
+static void Trace_Test_Decision(char **implications, double *confidences, int amount, char *expected, int expectedOperationID)
+{
+    NAR *nar = NAR_New();
+    double motorBabbling = MOTOR_BABBLING_CHANCE;
+    MOTOR_BABBLING_CHANCE = 0;
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^op1"), Trace_Test_Op);
+    NAR_AddOperation(nar, Narsese_AtomicTerm("^op2"), Trace_Test_Op);
+    for(int i=0; i<amount; i++)
+    {
+        NAR_AddInput(nar, Narsese_Term(implications[i]), EVENT_TYPE_BELIEF, Truth_New(1.0, confidences[i]), true);
+    }
+    char *preconditions[] = { "a", "b", "c", "d" };
+    for(int i=0; i<4; i++)
+    {
+        NAR_AddInputBelief(nar, Narsese_AtomicTerm(preconditions[i]));
+    }
+    char *path = "trace_decision_test.bin";
+    assert(Trace_Start(path), "Trace file should be writable");
+    NAR_AddInputGoal(nar, Narsese_AtomicTerm("g"));
+    Trace_Stop();
+    FILE *trace = fopen(path, "rb");
+    assert(fseek(trace, 6, SEEK_SET) == 0, "Trace should have a header");
+    int operationID = 0;
+    Term decided, expectedTerm = Narsese_Term(expected);
+    assert(Trace_Test_NextDecision(trace, &operationID, &decided), "The decision should have been traced");
+    assert(operationID == expectedOperationID && Term_Equal(&decided, &expectedTerm), "The implication the decision came from should be traced");
+    fclose(trace);
+    remove(path);
+    MOTOR_BABBLING_CHANCE = motorBabbling;
+    NAR_Free(nar);
+}
+
+void Trace_Test()
+{
+    puts(">>Trace test start");
+    Narsese_INIT();
+    NAR *nar = NAR_New();
+    char *path = "trace_test.bin";
+    assert(Trace_Start(path), "Trace file should be writable");
+    NAR_AddInputBelief(nar, Narsese_AtomicTerm("traced"));
+    Trace_Stop();
+    FILE *trace = fopen(path, "rb");
+    char magic[4];
+    uint16_t version;
+    assert(fread(magic, 1, 4, trace) == 4 && !strncmp(magic, "YANT", 4), "Trace should start with the magic");
+    assert(fread(&version, 2, 1, trace) == 1 && version == TRACE_VERSION, "Trace version mismatch");
+    //skip to the records of the input:
+    int c, atomRecord = 0, knowledgeRecord = 0;
+    while((c = fgetc(trace)) != EOF)
+    {
+        if(c == 'A' && !atomRecord)
+        {
+            atomRecord = fgetc(trace) == Narsese_AtomicTermIndex("traced");
+        }
+        else
+        if(c == 'K' && atomRecord)
+        {
+            knowledgeRecord = fgetc(trace) == TRACE_FLAG_INPUT;
+            break;
+        }
+    }
+    assert(atomRecord && knowledgeRecord, "The input should be traced after its atom name");
+    fclose(trace);
+    remove(path);
+    NAR_Free(nar);
+    //two candidates of the same operation, the better one comes first in the table
+    char *sameOperation[] = { "<(a &/ ^op1) =/> g>", "<(b &/ ^op1) =/> g>" };
+    Trace_Test_Decision(sameOperation, (double[]) { 0.9, 0.5 }, 2, "<(a &/ ^op1) =/> g>", 1);
+    //several candidates of two operations, the best one is neither first nor last
+    char *severalOperations[] = { "<(a &/ ^op1) =/> g>", "<(b &/ ^op2) =/> g>", "<(c &/ ^op1) =/> g>", "<(d &/ ^op2) =/> g>" };
+    Trace_Test_Decision(severalOperations, (double[]) { 0.6, 0.9, 0.4, 0.3 }, 4, "<(b &/ ^op2) =/> g>", 2);
+    puts(">>Trace test successful");
+}
@@ -0,0 +1,66 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+void Truth_Test()
+{
+    puts(">>Truth test start");
+    Truth v = Truth_New(0.9, 0.8);
+    //tabulated and computed decays are the same up to the resolution of the numeric profile, also after the decay was changed
+    double decay = TRUTH_PROJECTION_DECAY;
+    for(int k=0; k<2; k++)
+    {
+        for(long d=0; d<TRUTH_PROJECTION_TABLE_SIZE+10; d++)
+        {
+            Truth projected = Truth_Projection(v, 100, 100+d);
+            assert(projected.frequency == v.frequency && fabs(Truth_Confidence(projected) - Truth_Confidence(v) * pow(TRUTH_PROJECTION_DECAY, d)) <= NUMERIC_EPSILON, "Projection should decay by the power of the distance");
+            assert(Truth_Projection(v, 100+d, 100).confidence == projected.confidence, "Projection should be symmetric in time");
+        }
+        Truth_SetProjectionDecay(0.5);
+    }
+    Truth_SetProjectionDecay(decay);
+    Truth eternal = Truth_Projection(v, OCCURRENCE_ETERNAL, 100);
+    assert(Truth_Equal(&eternal, &v), "Eternal truth shouldn't be projected");
+    //batch functions give the same results as the single ones
+    Truth v1[TRUTH_BATCH_SIZE], v2[TRUTH_BATCH_SIZE], deduced[TRUTH_BATCH_SIZE], projected[TRUTH_BATCH_SIZE];
+    long times[TRUTH_BATCH_SIZE];
+    double expectations[TRUTH_BATCH_SIZE];
+    for(int i=0; i<TRUTH_BATCH_SIZE; i++)
+    {
+        v1[i] = Truth_New((i % 10) / 10.0, 0.9 - (i % 7) / 10.0);
+        v2[i] = Truth_New(1.0 - (i % 3) / 10.0, 0.5 + (i % 4) / 10.0);
+        times[i] = i % 5 == 0 ? OCCURRENCE_ETERNAL : i * 37;
+    }
+    Truth_DeductionBatch(v1, v2, deduced, TRUTH_BATCH_SIZE);
+    Truth_ProjectionBatch(v1, times, 1000, projected, TRUTH_BATCH_SIZE);
+    Truth_ExpectationBatch(v1, expectations, TRUTH_BATCH_SIZE);
+    for(int i=0; i<TRUTH_BATCH_SIZE; i++)
+    {
+        Truth deduction = Truth_Deduction(v1[i], v2[i]);
+        Truth projection = Truth_Projection(v1[i], times[i], 1000);
+        assert(Truth_Equal(&deduced[i], &deduction), "Batch deduction should match deduction");
+        assert(Truth_Equal(&projected[i], &projection), "Batch projection should match projection");
+        assert(expectations[i] == Truth_Expectation(v1[i]), "Batch expectation should match expectation");
+    }
+    puts("<<Truth test successful");
+}
@@ -0,0 +1,92 @@
+/* 
+ * The MIT License
+ *
+ * Copyright 2020 The OpenNARS authors.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+static int YAN_Test_executions = 0;
+static void YAN_Test_Op(YAN *yan, const char *operation, const char *args, void *userdata)
+{
+    (void) yan;
+    assert(!strcmp(operation, "^op") && !strcmp(args, "") && *(int*) userdata == 42, "Wrong operation callback arguments");
+    YAN_Test_executions++;
+}
+
+//Shows the instance a few times that ^op leads to result after a, then asks for result after a
+static void YAN_Test_LearnProcedure(YAN *yan)
+{
+    for(int i=0; i<3; i++)
+    {
+        YAN_AddInput(yan, "a. :|:");
+        YAN_AddInput(yan, "^op. :|:");
+        YAN_AddInput(yan, "result. :|:");
+        YAN_Cycles(yan, 5);
+    }
+    YAN_AddInput(yan, "a. :|:");
+    YAN_AddInput(yan, "result! :|:");
+}
+
+void YAN_Test()
+{
+    puts(">>YAN embedding API test start");
+    bool outputEnabled = OUTPUT_ENABLED;
+    double motorBabbling = MOTOR_BABBLING_CHANCE;
+    MOTOR_BABBLING_CHANCE = 0; //only the learned procedure executes the operation
+    YAN_Test_executions = 0;
+    YAN_Init();
+    YAN *yan = YAN_New();
+    int userdata = 42;
+    assert(!YAN_AddOperation(yan, "op", YAN_Test_Op, &userdata), "Operations have to start with ^");
+    assert(YAN_AddOperation(yan, "^op", YAN_Test_Op, &userdata), "Operation should have been registered");
+    assert(!YAN_AddInput(yan, "<a --> b"), "Malformed input should be rejected");
+    assert(!YAN_AddInput(yan, "<a --> b>?"), "Questions are asked, not input");
+    assert(YAN_AddInput(yan, "<a --> b>."), "Input should be accepted");
+    assert(YAN_AddInput(yan, "<b --> c>. {1.0 0.9}"), "Input should be accepted");
+    YAN_Cycles(yan, 5);
+    YAN_Answer answer;
+    assert(YAN_Ask(yan, "<a --> c>", &answer) == YAN_MALFORMED, "Missing punctuation should be detected");
+    assert(YAN_Ask(yan, "<c --> d>?", &answer) == YAN_UNANSWERED, "There is no evidence for <c --> d>");
+    assert(YAN_Ask(yan, "<a --> c>?", &answer) == YAN_ANSWERED, "Deduction should answer the question");
+    assert(!strcmp(answer.term, "<a --> c>") && !answer.isEvent && answer.frequency == 1.0 && answer.confidence > 0.8, "Wrong answer");
+    bool inputSeen = false, derivationSeen = false;
+    YAN_Knowledge derivation;
+    while(YAN_NextDerivation(yan, &derivation))
+    {
+        inputSeen |= !strcmp(derivation.term, "<a --> b>") && derivation.flags == YAN_INPUT && derivation.punctuation == '.';
+        derivationSeen |= !strcmp(derivation.term, "<a --> c>") && (derivation.flags & YAN_DERIVED);
+    }
+    assert(inputSeen && derivationSeen, "Input and derivation should have been iterated");
+    assert(YAN_DroppedDerivations(yan) == 0, "No derivation should have been dropped");
+    //procedure learning executes the operation through the callback
+    YAN_Test_LearnProcedure(yan);
+    assert(YAN_Test_executions > 0, "The operation callback should have been invoked");
+    //the operations are kept on reset
+    YAN_Reset(yan);
+    assert(YAN_Time(yan) == 1 && !YAN_NextDerivation(yan, &derivation), "Reset should clear the instance");
+    assert(YAN_Ask(yan, "<a --> c>?", &answer) == YAN_UNANSWERED, "Reset should clear the memory");
+    YAN_Test_executions = 0;
+    YAN_Test_LearnProcedure(yan);
+    assert(YAN_Test_executions > 0, "The operation should still be registered after reset");
+    YAN_Free(yan);
+    OUTPUT_ENABLED = outputEnabled;
+    MOTOR_BABBLING_CHANCE = motorBabbling;
+    puts("<<YAN embedding API test successful");
+}
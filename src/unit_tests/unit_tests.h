@@ -24,23 +24,46 @@
 
 #include "FIFO_Test.h"
 #include "Stamp_Test.h"
+#include "Truth_Test.h"
 #include "PriorityQueue_Test.h"
 #include "Memory_Test.h"
 #include "Narsese_Test.h"
 #include "RuleTable_Test.h"
-#include "Stack_Test.h"
 #include "Table_Test.h"
-#include "HashMap_Test.h"
+#include "BinaryInput_Test.h"
+#include "Trace_Test.h"
+#include "Query_Test.h"
+#include "NAR_Test.h"
+#include "YAN_Test.h"
+#include "EventQueue_Test.h"
+#include "EventBag_Test.h"
+#include "Runner_Test.h"
+#include "Cycle_Test.h"
+#include "Executor_Test.h"
+#include "Planner_Test.h"
+#include "TermStore_Test.h"
 
 void Run_Unit_Tests()
 {
     Stamp_Test();
+    Truth_Test();
     FIFO_Test();
     PriorityQueue_Test();
     Table_Test();
+    TermStore_Test();
     Memory_Test();
     Narsese_Test();
     RuleTable_Test();
-    Stack_Test();
-    HashTable_Test();
+    BinaryInput_Test();
+    Trace_Test();
+    Query_Test();
+    NAR_Test();
+    YAN_Test();
+    EventQueue_Test();
+    EventBag_Test();
+    Runner_Test();
+    Cycle_Test();
+    Cycle_Goals_Test();
+    Executor_Test();
+    Planner_Test();
 }
@@ -0,0 +1,96 @@
+#Decoder for the binary trace written by YAN when using *trace=<path> in the shell
+#Usage: python trace_decoder.py trace.bin [--csv]
+from __future__ import print_function
+import struct
+import sys
+
+COPULAS = {":": "-->", "$": "=/>", "+": "&/", ";": "&|", "=": "<->", "/": "/1", "%": "/2", "\\": "\\1", "#": "\\2"}
+STATEMENTS = set([":", "$", "="])
+ORIGINS = {0xFFFF: "input", 0xFFFE: "sensorimotor", 0xFFFD: "variable introduction", 0xFFFC: "prediction"}
+FLAGS = [(1, "input"), (2, "derived"), (4, "revised"), (8, "implication")]
+
+class Reader:
+    def __init__(self, data):
+        self.data = data
+        self.pos = 0
+    def read(self, fmt):
+        values = struct.unpack_from("=" + fmt, self.data, self.pos)
+        self.pos += struct.calcsize("=" + fmt)
+        return values if len(values) > 1 else values[0]
+    def bytes(self, n):
+        ret = self.data[self.pos:self.pos+n]
+        self.pos += n
+        return ret
+    def done(self):
+        return self.pos >= len(self.data)
+
+def term_string(atoms, names, index=1):
+    if index > len(atoms) or atoms[index-1] == 0:
+        return ""
+    name = names.get(atoms[index-1], "?")
+    left = term_string(atoms, names, index*2)
+    right = term_string(atoms, names, index*2+1)
+    if not left:
+        return COPULAS.get(name, name)
+    if name == "\"":
+        return "{" + left + ("" if right in ("", "@") else " " + right) + "}"
+    if name == "'":
+        return "[" + left + ("" if right in ("", "@") else " " + right) + "]"
+    if name == "!":
+        return "(-- " + left + ")"
+    inner = left + " " + COPULAS.get(name, name) + ("" if right in ("", "@") else " " + right)
+    return ("<" + inner + ">") if name in STATEMENTS else ("(" + inner + ")")
+
+def read_term(r):
+    n = r.read("B")
+    return list(bytearray(r.bytes(n)))
+
+def decode(data, csv=False):
+    r = Reader(data)
+    if r.bytes(4) != b"YANT":
+        raise ValueError("Not a YAN trace")
+    version = r.read("H")
+    if version != 2:
+        raise ValueError("Unsupported trace version %d" % version)
+    names, rules = {}, {}
+    if csv:
+        print("record,term,type,origin,flags,frequency,confidence,priority_or_desire,occurrenceTime,creationTime,stamp")
+    while not r.done():
+        kind = r.bytes(1)
+        if kind == b"A":
+            atom, length = r.read("BB")
+            names[atom] = r.bytes(length).decode()
+        elif kind == b"R":
+            rule, length = r.read("HH")
+            rules[rule] = r.bytes(length).decode()
+        elif kind == b"K":
+            flags, type_, rule, f, c, priority, occurrence, creation, stamp_len = r.read("BBHdddqqB")
+            stamp = r.read("%dq" % stamp_len) if stamp_len else ()
+            stamp = stamp if isinstance(stamp, tuple) else (stamp,)
+            term = term_string(read_term(r), names)
+            punctuation = "." if type_ == 2 else "!"
+            origin = ORIGINS.get(rule, rules.get(rule, "rule %d" % rule))
+            flag_names = "|".join(name for bit, name in FLAGS if flags & bit)
+            stamp_str = ";".join(str(s) for s in stamp)
+            occurrence_str = "eternal" if occurrence == -1 else str(occurrence)
+            if csv:
+                print('K,"%s",%s,"%s",%s,%f,%f,%f,%s,%d,%s' % (term, punctuation, origin, flag_names, f, c, priority, occurrence_str, creation, stamp_str))
+            else:
+                print("%s%s occurrenceTime=%s creationTime=%d Priority=%f Truth: frequency=%f, confidence=%f stamp=%s flags=%s origin=%s" %
+                      (term, punctuation, occurrence_str, creation, priority, f, c, stamp_str, flag_names, origin))
+        elif kind == b"X":
+            op, desire, f, c, offset, time = r.read("Hdddqq")
+            term = term_string(read_term(r), names)
+            if csv:
+                print('X,"%s",,"decision op %d",,%f,%f,%f,%d,%d,' % (term, op, f, c, desire, offset, time))
+            else:
+                print("decision at %d: op=%d desire=%f future=%d implication %s Truth: frequency=%f, confidence=%f" % (time, op, desire, offset, term, f, c))
+        else:
+            raise ValueError("Unknown record type %r at offset %d" % (kind, r.pos-1))
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        print("Usage: python trace_decoder.py trace.bin [--csv]")
+        sys.exit(1)
+    with open(sys.argv[1], "rb") as f:
+        decode(f.read(), "--csv" in sys.argv)
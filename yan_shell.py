@@ -0,0 +1,71 @@
+#YAN shell in-process: the line protocol of "./YAN shell" on top of the yan extension module
+#Build the module with "python3 setup.py build_ext --inplace" after build.sh, usage: python3 yan_shell.py < ./examples/nal/example1.nal
+import sys
+import yan
+
+#the operations of the C shell, in its registration order
+Operations = ["^left", "^right", "^up", "^down", "^say", "^pick", "^drop", "^go", "^activate", "^deactivate"]
+
+class Shell:
+    def __init__(self):
+        self.output = []
+        self.reset()
+
+    #fresh vocabulary and memory, as "**" in the C shell
+    def reset(self):
+        self.nar = None
+        yan.init()
+        self.nar = yan.NAR()
+        for op in Operations:
+            self.nar.add_operation(op, self.executed)
+
+    def executed(self, operation, args):
+        self.output.append(operation + " executed with args " + args)
+
+    #process a line of shell input, returns the output lines it produced
+    def process(self, line):
+        self.output = []
+        line = line.rstrip()
+        if line == "":
+            self.nar.cycles(1)
+        elif line.startswith("//"):
+            self.output.append("Comment: " + line[2:])
+        elif line == "**":
+            self.reset()
+        elif line.startswith("*") or line == "quit":
+            pass #output settings of the C shell, output is returned here
+        elif line[0].isdigit():
+            steps = int(line[:len(line) - len(line.lstrip("0123456789"))])
+            self.nar.cycles(steps)
+        elif not self.nar.add_input(line):
+            try:
+                answer = self.nar.ask(line)
+                self.output.append(FormatAnswer(answer))
+            except ValueError:
+                self.output.append("Parsing error: " + line)
+        return self.output
+
+#the answer in the format of the C shell
+def FormatAnswer(answer):
+    if answer is None:
+        return "Answer: None."
+    if answer["isEvent"]:
+        when = ". :|: occurrenceTime=%d creationTime=%d " % (answer["occurrenceTime"], answer["creationTime"])
+    else:
+        when = ". creationTime=%d " % answer["creationTime"]
+    return "Answer: " + answer["term"] + when + "Truth: frequency=%f, confidence=%f" % (answer["frequency"], answer["confidence"])
+
+#run the shell on lines, returning the output
+def Run(lines):
+    shell = Shell()
+    output = []
+    for line in lines:
+        output += shell.process(line)
+    return "\n".join(output)
+
+if __name__ == "__main__":
+    shell = Shell()
+    for line in sys.stdin:
+        for out in shell.process(line):
+            print(out)
+        sys.stdout.flush()